@@ -51,8 +51,27 @@ typedef struct BenchLoadingScreen {
     Uint32 gl_color_texture;
     int gl_uniform_time;
     int gl_uniform_progress;
+    double gl_context_ms;
 } BenchLoadingScreen;
 
+/*
+ * Everything the GL loading screen built that a GL suite can keep using.
+ * The quad is four x, y, u, v vertices indexed {0, 1, 2, 0, 2, 3}; the FBO
+ * has color_texture attached at width x height RGBA. The receiver owns all
+ * of it, and the GL library, once handed over.
+ */
+typedef struct {
+    SDL_Window *window;
+    SDL_GLContext context;
+    Uint32 vbo;
+    Uint32 ibo;
+    Uint32 fbo;
+    Uint32 color_texture;
+    int width;
+    int height;
+    double context_ms;   // Library load, window and context creation
+} BenchLoadingGL;
+
 SDL_bool bench_loading_begin(BenchLoadingScreen *screen,
                              SDL_Window *window,
                              SDL_Renderer *renderer,
@@ -69,8 +88,7 @@ void bench_loading_finish(BenchLoadingScreen *screen);
 
 void bench_loading_abort(BenchLoadingScreen *screen);
 
-SDL_bool bench_loading_obtain_gl(BenchLoadingScreen *screen,
-                                 SDL_Window **out_window,
-                                 SDL_GLContext *out_context);
+SDL_bool bench_loading_obtain_gl_resources(BenchLoadingScreen *screen,
+                                           BenchLoadingGL *out);
 
 #endif /* COMMON_LOADING_SCREEN_H */
@@ -42,9 +42,11 @@ typedef struct {
     Uint64 pixel_operations;
     Uint64 resource_allocations;
     Uint64 resource_deallocations;
+    Uint64 content_rebuilds;
     double lock_unlock_overhead_ms;
     double scaling_overhead_ms;
     double allocation_time_ms;
+    double content_generation_ms;
 } BenchMetrics;
 
 typedef struct {
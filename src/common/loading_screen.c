@@ -174,6 +174,8 @@ static SDL_bool bench_loading_setup_gl(BenchLoadingScreen *screen)
         return SDL_FALSE;
     }
 
+    const double ms_per_tick = 1000.0 / (double)SDL_GetPerformanceFrequency();
+    const Uint64 context_start = SDL_GetPerformanceCounter();
     if (!screen->gl_library_loaded) {
         SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_ES);
         SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 2);
@@ -216,6 +218,7 @@ static SDL_bool bench_loading_setup_gl(BenchLoadingScreen *screen)
                     SDL_GetError());
         return SDL_FALSE;
     }
+    screen->gl_context_ms = (double)(SDL_GetPerformanceCounter() - context_start) * ms_per_tick;
 
     Uint32 vs = bench_loading_compile(GL_VERTEX_SHADER, g_loading_vertex_shader);
     Uint32 fs = bench_loading_compile(GL_FRAGMENT_SHADER, g_loading_fragment_shader);
@@ -716,11 +719,14 @@ void bench_loading_abort(BenchLoadingScreen *screen)
     screen->active = SDL_FALSE;
 }
 
-SDL_bool bench_loading_obtain_gl(BenchLoadingScreen *screen,
-                                 SDL_Window **out_window,
-                                 SDL_GLContext *out_context)
+/*
+ * Hands the window, context and GL library over together with the quad
+ * buffers and FBO; only the loader's own program is deleted.
+ */
+SDL_bool bench_loading_obtain_gl_resources(BenchLoadingScreen *screen,
+                                           BenchLoadingGL *out)
 {
-    if (!screen) {
+    if (!screen || !out) {
         return SDL_FALSE;
     }
 
@@ -735,19 +741,28 @@ SDL_bool bench_loading_obtain_gl(BenchLoadingScreen *screen,
         return SDL_FALSE;
     }
 
-    bench_loading_release_gl_pipeline(screen);
-    bench_loading_clear_gl_stage(screen);
-
     if (!screen->gl_window || !screen->gl_context) {
         return SDL_FALSE;
     }
 
-    if (out_window) {
-        *out_window = screen->gl_window;
-    }
-    if (out_context) {
-        *out_context = screen->gl_context;
-    }
+    SDL_memset(out, 0, sizeof(*out));
+    out->window = screen->gl_window;
+    out->context = screen->gl_context;
+    out->vbo = screen->gl_vbo;
+    out->ibo = screen->gl_ibo;
+    out->fbo = screen->gl_fbo;
+    out->color_texture = screen->gl_color_texture;
+    out->width = screen->gl_width;
+    out->height = screen->gl_height;
+    out->context_ms = screen->gl_context_ms;
+
+    // Zeroed so the release below only deletes the program
+    screen->gl_vbo = 0;
+    screen->gl_ibo = 0;
+    screen->gl_fbo = 0;
+    screen->gl_color_texture = 0;
+    bench_loading_release_gl_pipeline(screen);
+    bench_loading_clear_gl_stage(screen);
 
     screen->gl_window = NULL;
     screen->gl_context = NULL;
@@ -3,6 +3,7 @@
 #include <SDL2/SDL.h>
 
 #include "controller_input.h"
+#include "render_suite/scene_registry.h"
 
 SDL_bool rs_handle_input(RenderSuiteState *state, BenchMetrics *metrics)
 {
@@ -28,20 +29,65 @@ SDL_bool rs_handle_input(RenderSuiteState *state, BenchMetrics *metrics)
                 case BTN_A:
                     state->auto_cycle = !state->auto_cycle;
                     break;
-                case BTN_B:
+                case BTN_L1:
+                    state->saturation_running = !state->saturation_running;
+                    break;
+                case BTN_R1:
+                    if (!state->saturation_running) {
+                        state->saturation_target = (state->saturation_target + 1) % RS_SATURATION_TARGETS;
+                    }
+                    break;
+                case BTN_B: {
+                    const RSSceneDesc *desc = rs_scene_desc(state->active_scene);
                     state->stress_level++;
-                    if (state->stress_level > 10) {
-                        state->stress_level = 1;
+                    if (state->stress_level > desc->stress_max) {
+                        state->stress_level = desc->stress_min;
                     }
                     break;
+                }
                 case BTN_X:
                     if (state->active_scene == SCENE_GEOMETRY) {
                         state->geometry_render_mode =
                             (state->geometry_render_mode + 1) % RS_GEOMETRY_RENDER_MODE_MAX;
+                    } else if (state->active_scene == SCENE_FILL) {
+                        state->fill_batched = !state->fill_batched;
+                    } else if (state->active_scene == SCENE_LINES) {
+                        state->lines_mode = (state->lines_mode + 1) % RS_LINES_MODE_MAX;
+                    } else if (state->active_scene == SCENE_MEMORY) {
+                        state->memory_mode = (state->memory_mode + 1) % RS_MEMORY_MODE_MAX;
+                    } else if (state->active_scene == SCENE_UPLOAD) {
+                        state->upload_method = (state->upload_method + 1) % RS_UPLOAD_METHOD_MAX;
+                    } else if (state->active_scene == SCENE_BANDWIDTH) {
+                        state->bandwidth_step = 0; // Restart the sweep
+                    } else if (state->active_scene == SCENE_CONVERT) {
+                        state->convert_format = (state->convert_format + 1) % RS_CONVERT_FORMAT_MAX;
+                    } else if (state->active_scene == SCENE_PIXELS &&
+                               state->pixel_mode != RS_PIXEL_MODE_PLASMA) {
+                        // Cellular cycles grid sizes, the others toggle
+                        const int options =
+                            (state->pixel_mode == RS_PIXEL_MODE_CELLULAR) ? RS_PIXEL_LIFE_GRIDS : 2;
+                        state->pixel_option[state->pixel_mode] = (state->pixel_option[state->pixel_mode] + 1) % options;
                     } else {
                         bench_reset_metrics(metrics);
                     }
                     break;
+                case BTN_Y:
+                    if (state->active_scene == SCENE_PIXELS) {
+                        // Alternate -> 1 thread -> 2 threads -> Alternate
+                        state->pixel_threads = (state->pixel_threads + 1) % (RS_PIXEL_THREADS_MAX + 1);
+                    } else if (state->active_scene == SCENE_MEMORY) {
+                        state->memory_async = !state->memory_async;
+                    } else if (state->active_scene == SCENE_UPLOAD) {
+                        state->upload_variant = (state->upload_variant + 1) % RS_UPLOAD_VARIANTS;
+                    } else if (state->active_scene == SCENE_CONVERT) {
+                        state->convert_path = (state->convert_path + 1) % RS_CONVERT_PATH_MAX;
+                    }
+                    break;
+                case BTN_UP:
+                    if (state->active_scene == SCENE_CONVERT) {
+                        state->convert_dst_format = (state->convert_dst_format + 1) % RS_CONVERT_FORMAT_MAX;
+                    }
+                    break;
                 case BTN_SELECT:
                     bench_reset_metrics(metrics);
                     break;
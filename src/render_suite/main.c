@@ -8,14 +8,8 @@
 #include "bench_common.h"
 #include "render_suite/input.h"
 #include "render_suite/overlay.h"
-#include "render_suite/resources.h"
-#include "render_suite/scenes/fill.h"
-#include "render_suite/scenes/lines.h"
-#include "render_suite/scenes/texture.h"
-#include "render_suite/scenes/geometry.h"
-#include "render_suite/scenes/scaling.h"
-#include "render_suite/scenes/memory.h"
-#include "render_suite/scenes/pixels.h"
+#include "render_suite/saturation.h"
+#include "render_suite/scene_registry.h"
 #include "render_suite/state.h"
 #include "common/loading_screen.h"
 
@@ -88,20 +82,19 @@ int main(int argc, char *argv[])
     }
 
     state.font = bench_load_font(16);
-    state.checker_texture = rs_create_checker_texture(renderer, 192, 192);
     if (loading_active) {
         bench_loading_step(&loading, 0.35f, "Preparing scenes");
     }
 
-    // Initialize new benchmark scenes
-    rs_scene_scaling_init(&state, renderer);
-    rs_scene_memory_init(&state, renderer);
-    rs_scene_pixels_init(&state, renderer);
-
     srand((unsigned int)time(NULL));
 
-    BenchMetrics metrics;
-    bench_reset_metrics(&metrics);
+    // Scenes build their resources on entry and free them on exit
+    RSSceneRegistry registry;
+    rs_scene_registry_init(&registry);
+    rs_scene_registry_enter(&registry, &state, renderer);
+
+    RSSaturationSearch saturation;
+    rs_saturation_init(&saturation);
 
     BenchOverlay *overlay = bench_overlay_create(renderer, BENCH_SCREEN_W, 16, 12);
     if (!overlay) {
@@ -109,6 +102,7 @@ int main(int argc, char *argv[])
         if (loading_active) {
             bench_loading_abort(&loading);
         }
+        rs_scene_registry_shutdown(&registry, &state);
         rs_state_destroy(&state, renderer);
         SDL_DestroyRenderer(renderer);
         SDL_DestroyWindow(window);
@@ -118,7 +112,7 @@ int main(int argc, char *argv[])
     }
 
     rs_state_update_layout(&state, overlay);
-    rs_overlay_submit(overlay, &state, &metrics);
+    rs_overlay_submit(overlay, &state, rs_scene_registry_metrics(&registry, state.active_scene));
     if (loading_active) {
         bench_loading_step(&loading, 0.8f, "Render suite ready");
         bench_loading_finish(&loading);
@@ -128,69 +122,60 @@ int main(int argc, char *argv[])
     printf("SDL2 Render Suite initialised\n");
 
     SDL_bool running = SDL_TRUE;
+    int measured_scene = -1;
+    int measured_level = 0;
+    double run_seconds = 0.0;
+    last_counter = SDL_GetPerformanceCounter();
     while (running) {
-        if (!rs_handle_input(&state, &metrics)) {
+        if (!rs_handle_input(&state, rs_scene_registry_metrics(&registry, state.active_scene))) {
             break;
         }
 
+        // The interval just measured belongs to whichever scene drew the last frame
         const double delta_seconds = bench_get_delta_seconds(&last_counter, perf_freq);
-
-        metrics.draw_calls = 0;
-        metrics.vertices_rendered = 0;
-        metrics.triangles_rendered = 0;
+        const BenchMetrics *measured_metrics = NULL;
+        if (measured_scene >= 0) {
+            BenchMetrics *scene_metrics = rs_scene_registry_metrics(&registry, (SceneKind)measured_scene);
+            bench_update_metrics(scene_metrics, delta_seconds * 1000.0);
+            measured_metrics = scene_metrics;
+        }
+        run_seconds += delta_seconds;
 
         rs_state_update_layout(&state, overlay);
 
         if (state.auto_cycle) {
-            const double elapsed_seconds = metrics.accumulated_frame_time_ms / 1000.0;
-            const int cycle = ((int)(elapsed_seconds / 5.0)) % SCENE_MAX;
-            state.active_scene = (SceneKind)cycle;
+            state.active_scene = rs_scene_auto_cycle((int)(run_seconds / 5.0));
+        }
+
+        rs_saturation_update(&saturation, &state, measured_scene, measured_level,
+                             delta_seconds * 1000.0, measured_metrics);
+
+        if (rs_scene_registry_enter(&registry, &state, renderer)) {
+            // Keep scene setup out of the first frame's timing
+            last_counter = SDL_GetPerformanceCounter();
         }
 
+        BenchMetrics *metrics = rs_scene_registry_metrics(&registry, state.active_scene);
+        metrics->draw_calls = 0;
+        metrics->vertices_rendered = 0;
+        metrics->triangles_rendered = 0;
+
         SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
         SDL_SetRenderDrawColor(renderer, 12, 16, 28, 255);
         SDL_RenderClear(renderer);
-        metrics.draw_calls++;
-
-        const double time_seconds = metrics.accumulated_frame_time_ms / 1000.0;
-
-        switch (state.active_scene) {
-            case SCENE_FILL:
-                rs_scene_fill(&state, renderer, &metrics, delta_seconds);
-                break;
-            case SCENE_TEXTURE:
-                rs_scene_texture(&state, renderer, &metrics, delta_seconds);
-                break;
-            case SCENE_LINES:
-                rs_scene_lines(&state, renderer, &metrics, time_seconds);
-                break;
-            case SCENE_GEOMETRY:
-                rs_scene_geometry(&state, renderer, &metrics, delta_seconds);
-                break;
-            case SCENE_SCALING:
-                rs_scene_scaling(&state, renderer, &metrics, delta_seconds);
-                break;
-            case SCENE_MEMORY:
-                rs_scene_memory(&state, renderer, &metrics, delta_seconds);
-                break;
-            case SCENE_PIXELS:
-                rs_scene_pixels(&state, renderer, &metrics, delta_seconds);
-                break;
-            default:
-                break;
-        }
+        metrics->draw_calls++;
+
+        rs_scene_desc(state.active_scene)->frame(&state, renderer, metrics, delta_seconds);
 
-        bench_overlay_present(overlay, renderer, &metrics, 0, 0);
+        bench_overlay_present(overlay, renderer, metrics, 0, 0);
         SDL_RenderPresent(renderer);
+        measured_scene = (int)state.active_scene;
+        measured_level = state.stress_level;
 
-        bench_update_metrics(&metrics, delta_seconds * 1000.0);
-        rs_overlay_submit(overlay, &state, &metrics);
+        rs_overlay_submit(overlay, &state, metrics);
     }
 
-    // Cleanup new benchmark scenes
-    rs_scene_scaling_cleanup(&state);
-    rs_scene_memory_cleanup(&state);
-    rs_scene_pixels_cleanup(&state);
+    rs_scene_registry_shutdown(&registry, &state);
 
     rs_state_destroy(&state, renderer);
     bench_overlay_destroy(overlay);
@@ -3,6 +3,9 @@
 #include <float.h>
 
 #include "common/overlay_grid.h"
+#include "render_suite/saturation.h"
+#include "render_suite/scene_registry.h"
+#include "render_suite/scenes/upload.h"
 
 static const char *rs_geometry_mode_labels[RS_GEOMETRY_RENDER_MODE_MAX] = {
     "Filled Faces",
@@ -10,6 +13,120 @@ static const char *rs_geometry_mode_labels[RS_GEOMETRY_RENDER_MODE_MAX] = {
     "Vertex Points"
 };
 
+static const char *rs_scaling_mode_labels[RS_SCALING_MODE_MAX] = {
+    "Logical",
+    "Viewport",
+    "Target",
+    "CPU Nearest",
+    "CPU Bilinear",
+    "CPU Integer"
+};
+
+static const char *rs_lines_mode_labels[RS_LINES_MODE_MAX] = {
+    "Per-line",
+    "Batched",
+    "Batched AA"
+};
+
+static double rs_overlay_lines_avg(const RenderSuiteState *state, int mode)
+{
+    const int level = SDL_clamp(state->stress_level, 1, RS_STRESS_LEVEL_MAX) - 1;
+    const Uint64 runs = state->lines_submit_runs[mode][level];
+    return runs ? state->lines_submit_ms[mode][level] / (double)runs : 0.0;
+}
+
+static const char *rs_memory_mode_labels[RS_MEMORY_MODE_MAX] = {
+    "Churn",
+    "Pooled"
+};
+
+static double rs_overlay_memory_alloc_avg(const RenderSuiteState *state, int mode)
+{
+    return state->memory_alloc_count[mode] ?
+        state->memory_alloc_ms[mode] / (double)state->memory_alloc_count[mode] : 0.0;
+}
+
+// X toggle per pixel effect; NULL where X keeps resetting metrics
+static const char *rs_pixel_option_labels[RS_PIXEL_MODE_MAX] = {
+    NULL,
+    "Large Grid",
+    "Progressive",
+    "Grid Size"
+};
+
+// Negative when the pool never ran a job at that width, e.g. on a single core
+static double rs_overlay_pixel_avg(const RenderSuiteState *state, int threads)
+{
+    const int mode = SDL_clamp(state->pixel_mode, 0, RS_PIXEL_MODE_MAX - 1);
+    const Uint64 runs = state->pixel_generate_runs[mode][threads - 1];
+    return runs ? state->pixel_generate_ms[mode][threads - 1] / (double)runs : -1.0;
+}
+
+static void rs_overlay_format_ms(char *buffer, size_t size, double ms)
+{
+    if (ms < 0.0) {
+        SDL_strlcpy(buffer, "n/a", size);
+    } else {
+        SDL_snprintf(buffer, size, "%.2fms", ms);
+    }
+}
+
+static const char *rs_convert_path_labels[RS_CONVERT_PATH_MAX] = {
+    "SDL",
+    "Upload",
+    "Scalar",
+    NULL // rs_scaler_variant_name(RS_SCALER_SIMD)
+};
+
+static double rs_overlay_convert_avg(const RenderSuiteState *state, int path, SDL_bool include_upload)
+{
+    const int format = SDL_clamp(state->convert_format, 0, RS_CONVERT_FORMAT_MAX - 1);
+    const int dst_format = SDL_clamp(state->convert_dst_format, 0, RS_CONVERT_FORMAT_MAX - 1);
+    const Uint64 runs = state->convert_runs[format][dst_format][path];
+    if (!runs) {
+        return 0.0;
+    }
+    const double ms = state->convert_cpu_ms[format][dst_format][path] +
+                      (include_upload ? state->convert_upload_ms[format][dst_format][path] : 0.0);
+    return ms / (double)runs;
+}
+
+static const char *rs_upload_method_labels[RS_UPLOAD_METHOD_MAX] = {
+    "Update",
+    "Lock",
+    "Surface",
+    "Target"
+};
+
+// Mean microseconds per upload, or "n/a" / "-" when unsupported / not run yet
+static void rs_overlay_upload_us(char *out, size_t size, const RenderSuiteState *state, int method, int variant)
+{
+    const Uint64 runs = state->upload_runs[method][variant];
+    if (!rs_scene_upload_supported(method, variant)) {
+        SDL_snprintf(out, size, "n/a");
+    } else if (!runs) {
+        SDL_snprintf(out, size, "-");
+    } else {
+        SDL_snprintf(out, size, "%.0f", state->upload_us[method][variant] / (double)runs);
+    }
+}
+
+// Working set in the largest whole unit, e.g. "256K" or "8M"
+static void rs_overlay_format_bytes(char *out, size_t size, int bytes)
+{
+    if (bytes >= 1024 * 1024) {
+        SDL_snprintf(out, size, "%dM", bytes / (1024 * 1024));
+    } else {
+        SDL_snprintf(out, size, "%dK", bytes / 1024);
+    }
+}
+
+static double rs_overlay_scaler_avg(const RenderSuiteState *state, int kind, int variant, int resolution)
+{
+    const Uint64 runs = state->scaling_cpu_runs[kind][variant][resolution];
+    return runs ? state->scaling_cpu_ms[kind][variant][resolution] / (double)runs : 0.0;
+}
+
 void rs_overlay_submit(BenchOverlay *overlay,
                        const RenderSuiteState *state,
                        const BenchMetrics *metrics)
@@ -18,16 +135,6 @@ void rs_overlay_submit(BenchOverlay *overlay,
         return;
     }
 
-    static const char *scene_names[SCENE_MAX] = {
-        "Fill Rate",
-        "Texture",
-        "Lines/Geometry",
-        "3D Geometry",
-        "Resolution Scaling",
-        "Memory Management",
-        "Pixel Operations"
-    };
-
     const SDL_Color accent = {255, 215, 0, 255};    // Gold for headers
     const SDL_Color primary = {255, 255, 255, 255}; // White for main content
     const SDL_Color cyan = {0, 200, 255, 255};      // Cyan for technical specs
@@ -51,7 +158,7 @@ void rs_overlay_submit(BenchOverlay *overlay,
     // Row 1 - Scene info left, first control right
     overlay_grid_set_cell(&grid, 1, 0, primary, 0,
                         "Scene: %s | Auto %s | Stress L%d x%.1f",
-                        scene_names[state->active_scene],
+                        rs_scene_desc(state->active_scene)->name,
                         state->auto_cycle ? "ON" : "OFF",
                         state->stress_level,
                         rs_state_stress_factor(state));
@@ -82,6 +189,22 @@ void rs_overlay_submit(BenchOverlay *overlay,
                         (unsigned long long)metrics->triangles_rendered);
     if (geometry_active) {
         overlay_grid_set_cell(&grid, 4, 1, primary, 0, "X - Cycle Mode | SELECT - Reset Metrics");
+    } else if (state->active_scene == SCENE_UPLOAD) {
+        overlay_grid_set_cell(&grid, 4, 1, primary, 0, "X - Upload Method | SELECT - Reset Metrics");
+    } else if (state->active_scene == SCENE_BANDWIDTH) {
+        overlay_grid_set_cell(&grid, 4, 1, primary, 0, "X - Restart Sweep | SELECT - Reset Metrics");
+    } else if (state->active_scene == SCENE_CONVERT) {
+        overlay_grid_set_cell(&grid, 4, 1, primary, 0, "X - Source Format | SELECT - Reset Metrics");
+    } else if (state->active_scene == SCENE_FILL) {
+        overlay_grid_set_cell(&grid, 4, 1, primary, 0, "X - Batch Rects | SELECT - Reset Metrics");
+    } else if (state->active_scene == SCENE_LINES) {
+        overlay_grid_set_cell(&grid, 4, 1, primary, 0, "X - Line Mode | SELECT - Reset Metrics");
+    } else if (state->active_scene == SCENE_MEMORY) {
+        overlay_grid_set_cell(&grid, 4, 1, primary, 0, "X - Pool Mode | SELECT - Reset Metrics");
+    } else if (state->active_scene == SCENE_PIXELS &&
+               rs_pixel_option_labels[SDL_clamp(state->pixel_mode, 0, RS_PIXEL_MODE_MAX - 1)]) {
+        overlay_grid_set_cell(&grid, 4, 1, primary, 0, "X - %s | SELECT - Reset Metrics",
+                              rs_pixel_option_labels[state->pixel_mode]);
     } else {
         overlay_grid_set_cell(&grid, 4, 1, primary, 0, "X / SELECT - Reset Metrics");
     }
@@ -91,11 +214,222 @@ void rs_overlay_submit(BenchOverlay *overlay,
         overlay_grid_set_cell(&grid, 5, 0, amber, 0,
                               "Geometry Mode: %s",
                               rs_geometry_mode_labels[geometry_mode_index]);
+    } else if (state->active_scene == SCENE_SCALING) {
+        const int mode = SDL_clamp(state->scaling_mode, 0, RS_SCALING_MODE_MAX - 1);
+        const int resolution = SDL_clamp(state->scaling_resolution, 0, RS_SCALING_RESOLUTION_MAX - 1);
+        if (mode >= RS_SCALING_MODE_CPU_NEAREST) {
+            const int kind = mode - RS_SCALING_MODE_CPU_NEAREST;
+            overlay_grid_set_cell(&grid, 5, 0, amber, 0,
+                                  "%s %dx%d: %s %.2fms | %s %.2fms",
+                                  rs_scaling_mode_labels[mode],
+                                  state->scaling_current_width,
+                                  state->scaling_current_height,
+                                  rs_scaler_variant_name(RS_SCALER_SIMD),
+                                  rs_overlay_scaler_avg(state, kind, RS_SCALER_SIMD, resolution),
+                                  rs_scaler_variant_name(RS_SCALER_SCALAR),
+                                  rs_overlay_scaler_avg(state, kind, RS_SCALER_SCALAR, resolution));
+        } else {
+            overlay_grid_set_cell(&grid, 5, 0, amber, 0,
+                                  "%s | Cache %llu rebuilds | Gen %.2fms",
+                                  rs_scaling_mode_labels[mode],
+                                  (unsigned long long)metrics->content_rebuilds,
+                                  metrics->content_generation_ms);
+        }
+    } else if (state->active_scene == SCENE_UPLOAD) {
+        const int variant = SDL_clamp(state->upload_variant, 0, RS_UPLOAD_VARIANTS - 1);
+        char us[RS_UPLOAD_METHOD_MAX][16];
+        for (int method = 0; method < RS_UPLOAD_METHOD_MAX; ++method) {
+            rs_overlay_upload_us(us[method], sizeof(us[method]), state, method, variant);
+        }
+        overlay_grid_set_cell(&grid, 5, 0, amber, 0,
+                              "us/upload | %s %s | %s %s | %s %s | %s %s",
+                              rs_upload_method_labels[0], us[0],
+                              rs_upload_method_labels[1], us[1],
+                              rs_upload_method_labels[2], us[2],
+                              rs_upload_method_labels[3], us[3]);
+    } else if (state->active_scene == SCENE_BANDWIDTH) {
+        const int total = state->bandwidth_sizes * (RS_BANDWIDTH_TEST_MAX + 1);
+        const int last = SDL_clamp(state->bandwidth_step / (RS_BANDWIDTH_TEST_MAX + 1) - 1,
+                                   0, RS_BANDWIDTH_SIZES - 1);
+        char size_text[16];
+        rs_overlay_format_bytes(size_text, sizeof(size_text), 4096 << last);
+        overlay_grid_set_cell(&grid, 5, 0, amber, 0,
+                              "%s %d/%d | %s: Rd %.0f | Wr %.0f | Cpy %.0f/%.0f/%.0f MB/s",
+                              state->bandwidth_exported ? "Done" : "Sweep",
+                              state->bandwidth_step,
+                              total,
+                              size_text,
+                              state->bandwidth_mbps[RS_BANDWIDTH_READ][last],
+                              state->bandwidth_mbps[RS_BANDWIDTH_WRITE][last],
+                              state->bandwidth_mbps[RS_BANDWIDTH_COPY_MEMCPY][last],
+                              state->bandwidth_mbps[RS_BANDWIDTH_COPY_NEON_U32][last],
+                              state->bandwidth_mbps[RS_BANDWIDTH_COPY_NEON_MEMCPY][last]);
+    } else if (state->active_scene == SCENE_CONVERT) {
+        overlay_grid_set_cell(&grid, 5, 0, amber, 0,
+                              "%s>%s ms/f | SDL %.2f | Upload %.2f | Scalar %.2f | %s %.2f",
+                              rs_convert_format_name((RSConvertFormat)SDL_clamp(state->convert_format, 0,
+                                                                                RS_CONVERT_FORMAT_MAX - 1)),
+                              rs_convert_format_name((RSConvertFormat)SDL_clamp(state->convert_dst_format, 0,
+                                                                                RS_CONVERT_FORMAT_MAX - 1)),
+                              rs_overlay_convert_avg(state, RS_CONVERT_PATH_SDL, SDL_TRUE),
+                              rs_overlay_convert_avg(state, RS_CONVERT_PATH_UPLOAD, SDL_TRUE),
+                              rs_overlay_convert_avg(state, RS_CONVERT_PATH_SCALAR, SDL_TRUE),
+                              rs_scaler_variant_name(RS_SCALER_SIMD),
+                              rs_overlay_convert_avg(state, RS_CONVERT_PATH_SIMD, SDL_TRUE));
+    } else if (state->active_scene == SCENE_FILL) {
+        const double per_rect_ms = state->fill_submit_runs[0] ?
+            state->fill_submit_ms[0] / (double)state->fill_submit_runs[0] : 0.0;
+        const double batched_ms = state->fill_submit_runs[1] ?
+            state->fill_submit_ms[1] / (double)state->fill_submit_runs[1] : 0.0;
+        overlay_grid_set_cell(&grid, 5, 0, amber, 0,
+                              "%s | Submit Per-rect %.3fms | Batched %.3fms",
+                              state->fill_batched ? "Batched" : "Per-rect",
+                              per_rect_ms,
+                              batched_ms);
+    } else if (state->active_scene == SCENE_LINES) {
+        const int mode = SDL_clamp(state->lines_mode, 0, RS_LINES_MODE_MAX - 1);
+        overlay_grid_set_cell(&grid, 5, 0, amber, 0,
+                              "%s | Submit Per-line %.3fms | Batched %.3fms | AA %.3fms",
+                              rs_lines_mode_labels[mode],
+                              rs_overlay_lines_avg(state, RS_LINES_MODE_PER_LINE),
+                              rs_overlay_lines_avg(state, RS_LINES_MODE_BATCHED),
+                              rs_overlay_lines_avg(state, RS_LINES_MODE_BATCHED_AA));
+    } else if (state->active_scene == SCENE_MEMORY) {
+        const int mode = SDL_clamp(state->memory_mode, 0, RS_MEMORY_MODE_MAX - 1);
+        overlay_grid_set_cell(&grid, 5, 0, amber, 0,
+                              "%s | Alloc Churn %.3fms | Pooled %.3fms | Hit %.0f%% | Waste %.0f%%",
+                              rs_memory_mode_labels[mode],
+                              rs_overlay_memory_alloc_avg(state, RS_MEMORY_MODE_CHURN),
+                              rs_overlay_memory_alloc_avg(state, RS_MEMORY_MODE_POOLED),
+                              state->memory_pool_hit_rate * 100.0,
+                              state->memory_pool_waste * 100.0);
+    } else if (state->active_scene == SCENE_PIXELS) {
+        const double single_ms = rs_overlay_pixel_avg(state, 1);
+        const double dual_ms = rs_overlay_pixel_avg(state, 2);
+        char single_label[16];
+        char dual_label[16];
+        rs_overlay_format_ms(single_label, sizeof(single_label), single_ms);
+        rs_overlay_format_ms(dual_label, sizeof(dual_label), dual_ms);
+        overlay_grid_set_cell(&grid, 5, 0, amber, 0,
+                              "Gen 1T %s | 2T %s (x%.2f) | Overlap %.0f%%",
+                              single_label,
+                              dual_label,
+                              (single_ms > 0.0 && dual_ms > 0.0) ? single_ms / dual_ms : 0.0,
+                              state->pixel_upload_ms > 0.0 ?
+                                  state->pixel_overlap_ms / state->pixel_upload_ms * 100.0 : 0.0);
     } else {
         overlay_grid_set_cell(&grid, 5, 0, amber, 0,
                               "Single-threaded Hardware Rendering");
     }
     overlay_grid_set_cell(&grid, 5, 1, info, 0, "START/ESC - Exit");
+    if (state->active_scene == SCENE_MEMORY) {
+        overlay_grid_set_cell(&grid, 6, 1, primary, 0,
+                              "Y - Async Content: %s", state->memory_async ? "On" : "Off");
+        overlay_grid_set_cell(&grid, 8, 1, amber, 0,
+                              "Ready %.1f | Busy %.0f%% | Misses %llu | Upload %.2fms/f",
+                              state->memory_queue_depth,
+                              state->memory_producer_busy * 100.0,
+                              (unsigned long long)state->memory_content_misses,
+                              state->memory_upload_frames ?
+                                  state->memory_upload_ms / (double)state->memory_upload_frames : 0.0);
+    }
+    if (state->active_scene == SCENE_UPLOAD) {
+        const int method = SDL_clamp(state->upload_method, 0, RS_UPLOAD_METHOD_MAX - 1);
+        const int variant = SDL_clamp(state->upload_variant, 0, RS_UPLOAD_VARIANTS - 1);
+        const double us = state->upload_us[method][variant];
+        overlay_grid_set_cell(&grid, 6, 1, primary, 0, "Y - %s %s",
+                              (variant & RS_UPLOAD_VARIANT_SUBRECT) ? "Sub-rect" : "Full Frame",
+                              (variant & RS_UPLOAD_VARIANT_STATIC) ? "Static" : "Streaming");
+        if (rs_scene_upload_supported(method, variant)) {
+            overlay_grid_set_cell(&grid, 7, 1, green, 0, "%s: %.0f us | %.1f MB/s",
+                                  rs_upload_method_labels[method],
+                                  state->upload_runs[method][variant] ?
+                                      us / (double)state->upload_runs[method][variant] : 0.0,
+                                  us > 0.0 ? (double)state->upload_bytes[method][variant] / us : 0.0);
+        } else {
+            overlay_grid_set_cell(&grid, 7, 1, amber, 0, "%s needs a streaming texture",
+                                  rs_upload_method_labels[method]);
+        }
+    }
+    if (state->active_scene == SCENE_BANDWIDTH) {
+        char knees[96] = "Knees: pending";
+        if (state->bandwidth_exported) {
+            int length = SDL_snprintf(knees, sizeof(knees), "Knees:");
+            for (int k = 0; k < state->bandwidth_knee_count && length < (int)sizeof(knees); ++k) {
+                char size_text[16];
+                rs_overlay_format_bytes(size_text, sizeof(size_text), state->bandwidth_knee_bytes[k]);
+                length += SDL_snprintf(knees + length, sizeof(knees) - (size_t)length, " L%d %s |", k + 1, size_text);
+            }
+            if (length < (int)sizeof(knees) && state->bandwidth_sizes > 0) {
+                SDL_snprintf(knees + length, sizeof(knees) - (size_t)length, " Far %.0fns",
+                             state->bandwidth_latency_ns[state->bandwidth_sizes - 1]);
+            }
+        }
+        overlay_grid_set_cell(&grid, 6, 1, primary, 0, "Cpy: memcpy / NEON u32 / neon_memcpy");
+        overlay_grid_set_cell(&grid, 7, 1, green, 0, "%s", knees);
+        overlay_grid_set_cell(&grid, 8, 1, amber, 0, "Blue Rd | Green Wr | Or/Pink/White Cpy | Red ns");
+    }
+    if (state->active_scene == SCENE_CONVERT) {
+        const int path = SDL_clamp(state->convert_path, 0, RS_CONVERT_PATH_MAX - 1);
+        const char *path_label = rs_convert_path_labels[path] ?
+            rs_convert_path_labels[path] : rs_scaler_variant_name(RS_SCALER_SIMD);
+        const double convert_ms = rs_overlay_convert_avg(state, path, SDL_FALSE);
+        const double total_ms = rs_overlay_convert_avg(state, path, SDL_TRUE);
+        overlay_grid_set_cell(&grid, 6, 1, primary, 0, "UP - Dest Format | Y - Path: %s", path_label);
+        overlay_grid_set_cell(&grid, 7, 1, state->convert_check_mismatches == 0 ? green : amber, 0,
+                              "Convert %.2fms | Upload %.2fms | %.1f MP/s | Check %d",
+                              convert_ms,
+                              total_ms - convert_ms,
+                              total_ms > 0.0 ?
+                                  (double)BENCH_SCREEN_W * BENCH_SCREEN_H / (total_ms * 1000.0) : 0.0,
+                              state->convert_check_mismatches);
+    }
+    if (state->active_scene == SCENE_MEMORY && state->memory_mode == RS_MEMORY_MODE_POOLED) {
+        overlay_grid_set_cell(&grid, 7, 1, amber, 0,
+                              "Pool %llu KB / %llu KB | Evictions %llu",
+                              (unsigned long long)(state->memory_pool_resident_bytes / 1024),
+                              (unsigned long long)(state->memory_pool_budget_bytes / 1024),
+                              (unsigned long long)state->memory_pool_evictions);
+    }
+    if (state->active_scene == SCENE_PIXELS) {
+        static const char *thread_labels[RS_PIXEL_THREADS_MAX + 1] = {"Alternate", "1", "2"};
+        overlay_grid_set_cell(&grid, 6, 1, primary, 0,
+                              "Y - Worker Threads: %s",
+                              thread_labels[SDL_clamp(state->pixel_threads, 0, RS_PIXEL_THREADS_MAX)]);
+        if (state->pixel_mode == RS_PIXEL_MODE_PLASMA) {
+            overlay_grid_set_cell(&grid, 7, 1, state->pixel_plasma_check_ok ? green : amber, 0,
+                                  "Plasma Ref %.1f | SIMD %.1f MP/s | Diff %d",
+                                  state->pixel_plasma_ref_mps,
+                                  state->pixel_plasma_simd_mps,
+                                  state->pixel_plasma_max_diff);
+        } else if (state->pixel_mode == RS_PIXEL_MODE_FIRE) {
+            overlay_grid_set_cell(&grid, 7, 1, amber, 0,
+                                  "Fire %dx%d | %.1f Mcell/s",
+                                  state->pixel_fire_width,
+                                  state->pixel_fire_height,
+                                  state->pixel_fire_ms > 0.0 ?
+                                      (double)state->pixel_fire_cells / (state->pixel_fire_ms * 1000.0) : 0.0);
+        } else if (state->pixel_mode == RS_PIXEL_MODE_CELLULAR) {
+            overlay_grid_set_cell(&grid, 7, 1, amber, 0,
+                                  "Life %dx%d (%d KB) | %.1f Mcell/s",
+                                  state->pixel_life_width,
+                                  state->pixel_life_height,
+                                  state->pixel_life_width / 8 * state->pixel_life_height / 1024,
+                                  state->pixel_life_ms > 0.0 ?
+                                      (double)state->pixel_life_cells / (state->pixel_life_ms * 1000.0) : 0.0);
+        } else if (state->pixel_mode == RS_PIXEL_MODE_MANDELBROT) {
+            const SDL_bool progressive = state->pixel_option[RS_PIXEL_MODE_MANDELBROT] ? SDL_TRUE : SDL_FALSE;
+            const double samples = (double)state->pixel_mandel_samples;
+            overlay_grid_set_cell(&grid, 7, 1, amber, 0,
+                                  "Mandel %d it | %.1f Mit/s | Skip %.0f%% | %s %d/4",
+                                  state->pixel_mandel_max_iterations,
+                                  state->pixel_mandel_ms > 0.0 ?
+                                      (double)state->pixel_mandel_iterations / (state->pixel_mandel_ms * 1000.0) : 0.0,
+                                  samples > 0.0 ? (double)state->pixel_mandel_skipped / samples * 100.0 : 0.0,
+                                  progressive ? "Prog" : "Full",
+                                  progressive ? (state->pixel_mandel_pass + 3) % 4 + 1 : 4);
+        }
+    }
 
     // Row 6 - Extended metrics: Memory and Resource stats
     overlay_grid_set_cell(&grid, 6, 0, cyan, 0,
@@ -125,5 +459,27 @@ void rs_overlay_submit(BenchOverlay *overlay,
                             metrics->allocation_time_ms);
     }
 
+    // Row 9 right - Saturation search
+    const int target = SDL_clamp(state->saturation_target, 0, RS_SATURATION_TARGETS - 1);
+    const RSSaturationResult *saturation =
+        &state->saturation_results[target][SDL_clamp((int)state->active_scene, 0, SCENE_MAX - 1)];
+    if (state->saturation_running) {
+        overlay_grid_set_cell(&grid, 9, 1, amber, 0,
+                              "L1 - Stop Search | Probe L%d | Last p95 %.1f/%.1fms",
+                              state->saturation_probe_level,
+                              state->saturation_probe_p95_ms,
+                              rs_saturation_target_ms(target));
+    } else if (saturation->measured) {
+        overlay_grid_set_cell(&grid, 9, 1, green, 0,
+                              "L1 - Search | R1 - %d FPS | Max L%d %.0fk vert/s",
+                              rs_saturation_target_fps(target),
+                              saturation->level,
+                              saturation->vertices_per_s / 1000.0);
+    } else {
+        overlay_grid_set_cell(&grid, 9, 1, primary, 0,
+                              "L1 - Saturation Search | R1 - Target %d FPS",
+                              rs_saturation_target_fps(target));
+    }
+
     overlay_grid_submit_to_overlay(&grid, overlay);
 }
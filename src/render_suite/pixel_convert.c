@@ -0,0 +1,326 @@
+#include "render_suite/pixel_convert.h"
+#include "render_suite/render_neon.h"
+
+Uint32 rs_convert_sdl_format(RSConvertFormat format)
+{
+    static const Uint32 formats[RS_CONVERT_FORMAT_MAX] = {
+        SDL_PIXELFORMAT_RGB565,
+        SDL_PIXELFORMAT_ARGB1555,
+        SDL_PIXELFORMAT_BGR888,
+        SDL_PIXELFORMAT_RGBA8888
+    };
+    return (format >= 0 && format < RS_CONVERT_FORMAT_MAX) ? formats[format] : SDL_PIXELFORMAT_UNKNOWN;
+}
+
+const char *rs_convert_format_name(RSConvertFormat format)
+{
+    static const char *names[RS_CONVERT_FORMAT_MAX] = {
+        "RGB565",
+        "ARGB1555",
+        "BGR888",
+        "RGBA8888"
+    };
+    return (format >= 0 && format < RS_CONVERT_FORMAT_MAX) ? names[format] : "Unknown";
+}
+
+int rs_convert_bytes_per_pixel(RSConvertFormat format)
+{
+    return (format == RS_CONVERT_RGB565 || format == RS_CONVERT_ARGB1555) ? 2 : 4;
+}
+
+/* ---- Scalar ------------------------------------------------------------- */
+
+/*
+ * Every source decodes to an RGBA8888 word and every destination encodes
+ * from one. The row converters below are generated per source/destination
+ * pair so the compiler inlines both halves into a single loop.
+ */
+
+static inline Uint32 rs_expand5(Uint32 v)
+{
+    return (v << 3) | (v >> 2);
+}
+
+static inline Uint32 rs_expand6(Uint32 v)
+{
+    return (v << 2) | (v >> 4);
+}
+
+static inline Uint32 rs_decode_rgb565(Uint32 p)
+{
+    return (rs_expand5(p >> 11) << 24) |
+           (rs_expand6((p >> 5) & 0x3F) << 16) |
+           (rs_expand5(p & 0x1F) << 8) |
+           0xFFu;
+}
+
+static inline Uint32 rs_decode_argb1555(Uint32 p)
+{
+    return (rs_expand5((p >> 10) & 0x1F) << 24) |
+           (rs_expand5((p >> 5) & 0x1F) << 16) |
+           (rs_expand5(p & 0x1F) << 8) |
+           ((p & 0x8000u) ? 0xFFu : 0x00u);
+}
+
+static inline Uint32 rs_decode_bgr888(Uint32 p)
+{
+    return ((p & 0x000000FFu) << 24) |
+           ((p & 0x0000FF00u) << 8) |
+           ((p & 0x00FF0000u) >> 8) |
+           0xFFu;
+}
+
+static inline Uint32 rs_decode_rgba8888(Uint32 p)
+{
+    return p;
+}
+
+static inline Uint16 rs_encode_rgb565(Uint32 rgba)
+{
+    return (Uint16)(((rgba >> 16) & 0xF800u) | ((rgba >> 13) & 0x07E0u) | ((rgba >> 11) & 0x001Fu));
+}
+
+static inline Uint16 rs_encode_argb1555(Uint32 rgba)
+{
+    return (Uint16)(((rgba << 8) & 0x8000u) |
+                    ((rgba >> 17) & 0x7C00u) |
+                    ((rgba >> 14) & 0x03E0u) |
+                    ((rgba >> 11) & 0x001Fu));
+}
+
+// The padding byte is left zero, as SDL's blitters leave it
+static inline Uint32 rs_encode_bgr888(Uint32 rgba)
+{
+    return ((rgba >> 24) & 0x000000FFu) |
+           ((rgba >> 8) & 0x0000FF00u) |
+           ((rgba << 8) & 0x00FF0000u);
+}
+
+static inline Uint32 rs_encode_rgba8888(Uint32 rgba)
+{
+    return rgba;
+}
+
+typedef void (*RSConvertRowFn)(const void *in, void *out, int width);
+
+#define RS_CONVERT_ROW_SCALAR(src, src_type, dst, dst_type)                               \
+    static void rs_convert_row_##src##_##dst##_scalar(const void *in, void *out, int width) \
+    {                                                                                      \
+        const src_type *pixels_in = (const src_type *)in;                                  \
+        dst_type *pixels_out = (dst_type *)out;                                            \
+        for (int x = 0; x < width; ++x) {                                                  \
+            pixels_out[x] = rs_encode_##dst(rs_decode_##src(pixels_in[x]));                \
+        }                                                                                  \
+    }
+
+#define RS_CONVERT_ROWS_SCALAR(src, src_type)                     \
+    RS_CONVERT_ROW_SCALAR(src, src_type, rgb565, Uint16)          \
+    RS_CONVERT_ROW_SCALAR(src, src_type, argb1555, Uint16)        \
+    RS_CONVERT_ROW_SCALAR(src, src_type, bgr888, Uint32)          \
+    RS_CONVERT_ROW_SCALAR(src, src_type, rgba8888, Uint32)
+
+RS_CONVERT_ROWS_SCALAR(rgb565, Uint16)
+RS_CONVERT_ROWS_SCALAR(argb1555, Uint16)
+RS_CONVERT_ROWS_SCALAR(bgr888, Uint32)
+RS_CONVERT_ROWS_SCALAR(rgba8888, Uint32)
+
+#define RS_CONVERT_TABLE_ROW(src, variant)         \
+    {                                              \
+        rs_convert_row_##src##_rgb565_##variant,   \
+        rs_convert_row_##src##_argb1555_##variant, \
+        rs_convert_row_##src##_bgr888_##variant,   \
+        rs_convert_row_##src##_rgba8888_##variant  \
+    }
+
+static const RSConvertRowFn rs_convert_rows_scalar[RS_CONVERT_FORMAT_MAX][RS_CONVERT_FORMAT_MAX] = {
+    RS_CONVERT_TABLE_ROW(rgb565, scalar),
+    RS_CONVERT_TABLE_ROW(argb1555, scalar),
+    RS_CONVERT_TABLE_ROW(bgr888, scalar),
+    RS_CONVERT_TABLE_ROW(rgba8888, scalar)
+};
+
+/* ---- NEON --------------------------------------------------------------- */
+
+#if RS_HAS_NEON
+/*
+ * Eight pixels at a time are decoded into byte planes in vst4 order: A, B,
+ * G, R, which is RGBA8888 on a little-endian core. 16-bit sources narrow
+ * each channel to the top bits of a byte with a shift-right-narrow, then
+ * re-insert the high bits below with VSRI. 16-bit destinations are built
+ * back up with VSHLL and VSRI, which truncates like the scalar encoders.
+ */
+typedef int (*RSConvertRowNeonFn)(const void *in, void *out, int width);
+
+static inline uint8x8x4_t rs_load8_rgb565(const void *in)
+{
+    const uint16x8_t p = vld1q_u16((const uint16_t *)in);
+    const uint8x8_t r = vand_u8(vshrn_n_u16(p, 8), vdup_n_u8(0xF8));
+    const uint8x8_t g = vand_u8(vshrn_n_u16(p, 3), vdup_n_u8(0xFC));
+    const uint8x8_t b = vmovn_u16(vshlq_n_u16(p, 3));
+    uint8x8x4_t px;
+    px.val[0] = vdup_n_u8(0xFF);
+    px.val[1] = vsri_n_u8(b, b, 5);
+    px.val[2] = vsri_n_u8(g, g, 6);
+    px.val[3] = vsri_n_u8(r, r, 5);
+    return px;
+}
+
+static inline uint8x8x4_t rs_load8_argb1555(const void *in)
+{
+    const uint16x8_t p = vld1q_u16((const uint16_t *)in);
+    const uint8x8_t mask = vdup_n_u8(0xF8);
+    const uint8x8_t r = vand_u8(vshrn_n_u16(p, 7), mask);
+    const uint8x8_t g = vand_u8(vshrn_n_u16(p, 2), mask);
+    const uint8x8_t b = vmovn_u16(vshlq_n_u16(p, 3));
+    uint8x8x4_t px;
+    px.val[0] = vtst_u8(vshrn_n_u16(p, 8), vdup_n_u8(0x80));
+    px.val[1] = vsri_n_u8(b, b, 5);
+    px.val[2] = vsri_n_u8(g, g, 5);
+    px.val[3] = vsri_n_u8(r, r, 5);
+    return px;
+}
+
+// Bytes in memory are R, G, B, pad
+static inline uint8x8x4_t rs_load8_bgr888(const void *in)
+{
+    const uint8x8x4_t bytes = vld4_u8((const uint8_t *)in);
+    uint8x8x4_t px;
+    px.val[0] = vdup_n_u8(0xFF);
+    px.val[1] = bytes.val[2];
+    px.val[2] = bytes.val[1];
+    px.val[3] = bytes.val[0];
+    return px;
+}
+
+static inline uint8x8x4_t rs_load8_rgba8888(const void *in)
+{
+    return vld4_u8((const uint8_t *)in);
+}
+
+static inline void rs_store8_rgb565(void *out, uint8x8x4_t px)
+{
+    uint16x8_t p = vshll_n_u8(px.val[3], 8);
+    p = vsriq_n_u16(p, vshll_n_u8(px.val[2], 8), 5);
+    p = vsriq_n_u16(p, vshll_n_u8(px.val[1], 8), 11);
+    vst1q_u16((uint16_t *)out, p);
+}
+
+static inline void rs_store8_argb1555(void *out, uint8x8x4_t px)
+{
+    uint16x8_t p = vshll_n_u8(px.val[0], 8);
+    p = vsriq_n_u16(p, vshll_n_u8(px.val[3], 8), 1);
+    p = vsriq_n_u16(p, vshll_n_u8(px.val[2], 8), 6);
+    p = vsriq_n_u16(p, vshll_n_u8(px.val[1], 8), 11);
+    vst1q_u16((uint16_t *)out, p);
+}
+
+static inline void rs_store8_bgr888(void *out, uint8x8x4_t px)
+{
+    uint8x8x4_t bytes;
+    bytes.val[0] = px.val[3];
+    bytes.val[1] = px.val[2];
+    bytes.val[2] = px.val[1];
+    bytes.val[3] = vdup_n_u8(0);
+    vst4_u8((uint8_t *)out, bytes);
+}
+
+static inline void rs_store8_rgba8888(void *out, uint8x8x4_t px)
+{
+    vst4_u8((uint8_t *)out, px);
+}
+
+#define RS_CONVERT_ROW_NEON(src, src_bytes, dst, dst_bytes)                              \
+    static int rs_convert_row_##src##_##dst##_neon(const void *in, void *out, int width) \
+    {                                                                                   \
+        int x = 0;                                                                      \
+        for (; x + 8 <= width; x += 8) {                                                \
+            rs_store8_##dst((Uint8 *)out + (size_t)x * (dst_bytes),                     \
+                            rs_load8_##src((const Uint8 *)in + (size_t)x * (src_bytes))); \
+        }                                                                               \
+        return x;                                                                       \
+    }
+
+#define RS_CONVERT_ROWS_NEON(src, src_bytes)            \
+    RS_CONVERT_ROW_NEON(src, src_bytes, rgb565, 2)      \
+    RS_CONVERT_ROW_NEON(src, src_bytes, argb1555, 2)    \
+    RS_CONVERT_ROW_NEON(src, src_bytes, bgr888, 4)      \
+    RS_CONVERT_ROW_NEON(src, src_bytes, rgba8888, 4)
+
+RS_CONVERT_ROWS_NEON(rgb565, 2)
+RS_CONVERT_ROWS_NEON(argb1555, 2)
+RS_CONVERT_ROWS_NEON(bgr888, 4)
+RS_CONVERT_ROWS_NEON(rgba8888, 4)
+
+// 0x00BBGGRR -> 0xRRGGBBFF is a byte reverse plus forced alpha, cheaper than the planes
+static int rs_convert_row_bgr888_rgba8888_rev_neon(const void *in, void *out, int width)
+{
+    const uint32x4_t alpha = vdupq_n_u32(0xFFu);
+    const Uint32 *pixels_in = (const Uint32 *)in;
+    Uint32 *pixels_out = (Uint32 *)out;
+    int x = 0;
+    for (; x + 8 <= width; x += 8) {
+        const uint8x16_t p0 = vld1q_u8((const uint8_t *)(pixels_in + x));
+        const uint8x16_t p1 = vld1q_u8((const uint8_t *)(pixels_in + x + 4));
+        vst1q_u32(pixels_out + x, vorrq_u32(vreinterpretq_u32_u8(vrev32q_u8(p0)), alpha));
+        vst1q_u32(pixels_out + x + 4, vorrq_u32(vreinterpretq_u32_u8(vrev32q_u8(p1)), alpha));
+    }
+    return x;
+}
+
+static const RSConvertRowNeonFn rs_convert_rows_neon[RS_CONVERT_FORMAT_MAX][RS_CONVERT_FORMAT_MAX] = {
+    RS_CONVERT_TABLE_ROW(rgb565, neon),
+    RS_CONVERT_TABLE_ROW(argb1555, neon),
+    {
+        rs_convert_row_bgr888_rgb565_neon,
+        rs_convert_row_bgr888_argb1555_neon,
+        rs_convert_row_bgr888_bgr888_neon,
+        rs_convert_row_bgr888_rgba8888_rev_neon
+    },
+    RS_CONVERT_TABLE_ROW(rgba8888, neon)
+};
+#endif
+
+void rs_convert_pixels(RSConvertFormat src_format,
+                       const void *src,
+                       int src_pitch,
+                       RSConvertFormat dst_format,
+                       void *dst,
+                       int dst_pitch,
+                       int width,
+                       int height,
+                       RSScalerVariant variant)
+{
+    if (!src || !dst || width <= 0 || height <= 0 ||
+        src_format < 0 || src_format >= RS_CONVERT_FORMAT_MAX ||
+        dst_format < 0 || dst_format >= RS_CONVERT_FORMAT_MAX) {
+        return;
+    }
+
+    const SDL_bool simd = (RS_HAS_NEON && variant == RS_SCALER_SIMD) ? SDL_TRUE : SDL_FALSE;
+    const int src_bytes = rs_convert_bytes_per_pixel(src_format);
+    const int dst_bytes = rs_convert_bytes_per_pixel(dst_format);
+    for (int y = 0; y < height; ++y) {
+        const Uint8 *row = (const Uint8 *)src + (size_t)y * (size_t)src_pitch;
+        Uint8 *out = (Uint8 *)dst + (size_t)y * (size_t)dst_pitch;
+
+        // Same format in and out: the copy is the baseline
+        if (src_format == dst_format) {
+            if (simd && src_bytes == 4) {
+                rs_neon_copy_u32((Uint32 *)out, (const Uint32 *)row, (size_t)width);
+            } else {
+                SDL_memcpy(out, row, (size_t)width * (size_t)src_bytes);
+            }
+            continue;
+        }
+
+        int done = 0;
+#if RS_HAS_NEON
+        if (simd) {
+            done = rs_convert_rows_neon[src_format][dst_format](row, out, width);
+        }
+#endif
+        rs_convert_rows_scalar[src_format][dst_format](row + (size_t)done * (size_t)src_bytes,
+                                                       out + (size_t)done * (size_t)dst_bytes,
+                                                       width - done);
+    }
+}
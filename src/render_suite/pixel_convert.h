@@ -0,0 +1,39 @@
+#ifndef RENDER_SUITE_PIXEL_CONVERT_H
+#define RENDER_SUITE_PIXEL_CONVERT_H
+
+#include <SDL2/SDL.h>
+
+#include "render_suite/scaler.h"
+
+// Frame formats emulator cores hand us and displays take, in the order the
+// convert scene cycles them
+typedef enum {
+    RS_CONVERT_RGB565 = 0,
+    RS_CONVERT_ARGB1555,
+    RS_CONVERT_BGR888,   // SDL's BGR888: 32-bit 0x00BBGGRR
+    RS_CONVERT_RGBA8888, // The suite's native format
+    RS_CONVERT_FORMAT_MAX
+} RSConvertFormat;
+
+Uint32 rs_convert_sdl_format(RSConvertFormat format);
+const char *rs_convert_format_name(RSConvertFormat format);
+int rs_convert_bytes_per_pixel(RSConvertFormat format);
+
+/*
+ * Converts a width x height frame between any two of the formats above,
+ * like SDL_ConvertPixels; both pitches are in bytes. 5- and 6-bit channels
+ * are widened by bit replication and narrowed by truncation, the same as
+ * SDL's blitters, so every variant produces identical output. Equal formats
+ * are a row copy. SIMD falls back to scalar on builds without NEON.
+ */
+void rs_convert_pixels(RSConvertFormat src_format,
+                       const void *src,
+                       int src_pitch,
+                       RSConvertFormat dst_format,
+                       void *dst,
+                       int dst_pitch,
+                       int width,
+                       int height,
+                       RSScalerVariant variant);
+
+#endif /* RENDER_SUITE_PIXEL_CONVERT_H */
@@ -58,4 +58,52 @@ static inline void rs_neon_fill_u32(uint32_t *dst, uint32_t value, size_t count)
 #endif
 }
 
+/*
+ * Writes a linear RGBA8888 colour ramp. Channels are 16.16 fixed point and
+ * must stay within [0, 255] over the whole span; alpha is forced opaque.
+ */
+static inline void rs_neon_ramp_rgba8888(uint32_t *dst,
+                                         size_t count,
+                                         int32_t r,
+                                         int32_t g,
+                                         int32_t b,
+                                         int32_t dr,
+                                         int32_t dg,
+                                         int32_t db)
+{
+    size_t i = 0;
+#if RS_HAS_NEON
+    static const int32_t lane_offsets[4] = {0, 1, 2, 3};
+    const int32x4_t lanes = vld1q_s32(lane_offsets);
+    int32x4_t vr = vmlaq_n_s32(vdupq_n_s32(r), lanes, dr);
+    int32x4_t vg = vmlaq_n_s32(vdupq_n_s32(g), lanes, dg);
+    int32x4_t vb = vmlaq_n_s32(vdupq_n_s32(b), lanes, db);
+    const int32x4_t step_r = vdupq_n_s32(dr * 4);
+    const int32x4_t step_g = vdupq_n_s32(dg * 4);
+    const int32x4_t step_b = vdupq_n_s32(db * 4);
+    const uint32x4_t alpha = vdupq_n_u32(0xFFu);
+    for (; i + 4 <= count; i += 4) {
+        const uint32x4_t pr = vshlq_n_u32(vreinterpretq_u32_s32(vshrq_n_s32(vr, 16)), 24);
+        const uint32x4_t pg = vshlq_n_u32(vreinterpretq_u32_s32(vshrq_n_s32(vg, 16)), 16);
+        const uint32x4_t pb = vshlq_n_u32(vreinterpretq_u32_s32(vshrq_n_s32(vb, 16)), 8);
+        vst1q_u32(dst + i, vorrq_u32(vorrq_u32(pr, pg), vorrq_u32(pb, alpha)));
+        vr = vaddq_s32(vr, step_r);
+        vg = vaddq_s32(vg, step_g);
+        vb = vaddq_s32(vb, step_b);
+    }
+    r += dr * (int32_t)i;
+    g += dg * (int32_t)i;
+    b += db * (int32_t)i;
+#endif
+    for (; i < count; ++i) {
+        dst[i] = ((uint32_t)(r >> 16) << 24) |
+                 ((uint32_t)(g >> 16) << 16) |
+                 ((uint32_t)(b >> 16) << 8) |
+                 0xFFu;
+        r += dr;
+        g += dg;
+        b += db;
+    }
+}
+
 #endif /* RENDER_SUITE_RENDER_NEON_H */
@@ -0,0 +1,253 @@
+#include "render_suite/saturation.h"
+#include "render_suite/scene_registry.h"
+
+#define SATURATION_WARMUP_FRAMES 15 // Let caches, pools and the GPU queue settle after a change
+#define SATURATION_PERCENTILE 0.95
+#define SATURATION_CSV_NAME "render_saturation.csv"
+
+static const int saturation_target_fps[RS_SATURATION_TARGETS] = {60, 30};
+
+double rs_saturation_target_ms(int target)
+{
+    return 1000.0 / (double)rs_saturation_target_fps(target);
+}
+
+int rs_saturation_target_fps(int target)
+{
+    return saturation_target_fps[SDL_clamp(target, 0, RS_SATURATION_TARGETS - 1)];
+}
+
+void rs_saturation_init(RSSaturationSearch *search)
+{
+    SDL_memset(search, 0, sizeof(*search));
+    search->scene = -1;
+}
+
+static int rs_saturation_compare(const void *a, const void *b)
+{
+    const double lhs = *(const double *)a;
+    const double rhs = *(const double *)b;
+    return (lhs > rhs) - (lhs < rhs);
+}
+
+static double rs_saturation_p95(const RSSaturationSearch *search)
+{
+    double sorted[RS_SATURATION_SAMPLES];
+    const int count = search->samples;
+    if (count == 0) {
+        return 0.0;
+    }
+    SDL_memcpy(sorted, search->frame_ms, sizeof(double) * (size_t)count);
+    SDL_qsort(sorted, (size_t)count, sizeof(double), rs_saturation_compare);
+    const int index = SDL_clamp((int)SDL_ceil(SATURATION_PERCENTILE * count) - 1, 0, count - 1);
+    return sorted[index];
+}
+
+static void rs_saturation_begin_probe(RSSaturationSearch *search, int level)
+{
+    search->level = level;
+    search->warmup = SATURATION_WARMUP_FRAMES;
+    search->samples = 0;
+    search->over_target = 0;
+    search->total_ms = 0.0;
+    search->draw_calls = 0;
+    search->vertices = 0;
+}
+
+// Next scene after `after` with more than one stress level, or -1
+static int rs_saturation_next_scene(int after)
+{
+    for (int scene = after + 1; scene < SCENE_MAX; ++scene) {
+        const RSSceneDesc *desc = rs_scene_desc((SceneKind)scene);
+        if (desc->stress_max > desc->stress_min) {
+            return scene;
+        }
+    }
+    return -1;
+}
+
+static void rs_saturation_begin_scene(RSSaturationSearch *search, int scene)
+{
+    const RSSceneDesc *desc = rs_scene_desc((SceneKind)scene);
+    search->scene = scene;
+    search->pass = desc->stress_min - 1;
+    search->fail = desc->stress_max + 1;
+    SDL_memset(&search->best, 0, sizeof(search->best));
+    rs_saturation_begin_probe(search, desc->stress_min);
+}
+
+// Logs every measured scene for the current target and writes them as CSV next to the binary
+static void rs_saturation_export(const RenderSuiteState *state)
+{
+    char *base_path = SDL_GetBasePath();
+    char path[512];
+    SDL_snprintf(path, sizeof(path), "%s%s", base_path ? base_path : "", SATURATION_CSV_NAME);
+    SDL_free(base_path);
+
+    SDL_RWops *csv = SDL_RWFromFile(path, "w");
+    static const char header[] = "scene,target_fps,max_level,p95_ms,draw_calls_per_s,vertices_per_s\n";
+    if (csv) {
+        SDL_RWwrite(csv, header, 1, sizeof(header) - 1);
+    }
+
+    for (int target = 0; target < RS_SATURATION_TARGETS; ++target) {
+        for (int scene = 0; scene < SCENE_MAX; ++scene) {
+            const RSSaturationResult *result = &state->saturation_results[target][scene];
+            if (!result->measured) {
+                continue;
+            }
+            char line[192];
+            SDL_snprintf(line, sizeof(line), "%s,%d,%d,%.2f,%.0f,%.0f\n",
+                         rs_scene_desc((SceneKind)scene)->name,
+                         rs_saturation_target_fps(target),
+                         result->level,
+                         result->p95_ms,
+                         result->draw_calls_per_s,
+                         result->vertices_per_s);
+            if (csv) {
+                SDL_RWwrite(csv, line, 1, SDL_strlen(line));
+            }
+        }
+    }
+
+    if (csv) {
+        SDL_RWclose(csv);
+        SDL_Log("Saturation results written to %s", path);
+    } else {
+        SDL_Log("Saturation: could not write %s: %s", path, SDL_GetError());
+    }
+}
+
+static void rs_saturation_finish_scene(RSSaturationSearch *search, RenderSuiteState *state)
+{
+    const RSSceneDesc *desc = rs_scene_desc((SceneKind)search->scene);
+    const int target = SDL_clamp(state->saturation_target, 0, RS_SATURATION_TARGETS - 1);
+    RSSaturationResult *result = &state->saturation_results[target][search->scene];
+
+    *result = search->best;
+    result->measured = SDL_TRUE;
+    result->level = SDL_max(search->pass, 0);
+    SDL_Log("Saturation %-18s @%dfps: L%d | p95 %.2fms | %.0f draws/s | %.0f verts/s",
+            desc->name,
+            rs_saturation_target_fps(target),
+            result->level,
+            result->p95_ms,
+            result->draw_calls_per_s,
+            result->vertices_per_s);
+
+    // Leave the scene at its sustainable level so the registry remembers it
+    state->stress_level = SDL_max(search->pass, desc->stress_min);
+
+    const int next = rs_saturation_next_scene(search->scene);
+    if (next < 0) {
+        rs_saturation_export(state);
+        search->running = SDL_FALSE;
+        search->scene = -1;
+        state->saturation_running = SDL_FALSE;
+        return;
+    }
+    rs_saturation_begin_scene(search, next);
+}
+
+// Records the finished probe and picks the next level, or ends the scene
+static void rs_saturation_finish_probe(RSSaturationSearch *search, RenderSuiteState *state, double p95_ms)
+{
+    const RSSceneDesc *desc = rs_scene_desc((SceneKind)search->scene);
+    const double target_ms = rs_saturation_target_ms(state->saturation_target);
+
+    state->saturation_probe_p95_ms = p95_ms;
+    if (p95_ms <= target_ms) {
+        search->pass = search->level;
+        search->best.p95_ms = p95_ms;
+        if (search->total_ms > 0.0) {
+            search->best.draw_calls_per_s = (double)search->draw_calls * 1000.0 / search->total_ms;
+            search->best.vertices_per_s = (double)search->vertices * 1000.0 / search->total_ms;
+        }
+    } else {
+        search->fail = search->level;
+    }
+
+    int next_level;
+    if (search->fail > desc->stress_max) {
+        // Still climbing: double until something misses or the range runs out
+        if (search->pass >= desc->stress_max) {
+            rs_saturation_finish_scene(search, state);
+            return;
+        }
+        next_level = SDL_min(search->pass * 2, desc->stress_max);
+    } else {
+        if (search->fail - search->pass <= 1) {
+            rs_saturation_finish_scene(search, state);
+            return;
+        }
+        next_level = (search->pass + search->fail) / 2;
+    }
+    rs_saturation_begin_probe(search, next_level);
+}
+
+void rs_saturation_update(RSSaturationSearch *search,
+                          RenderSuiteState *state,
+                          int frame_scene,
+                          int frame_level,
+                          double frame_ms,
+                          const BenchMetrics *frame_metrics)
+{
+    if (!search || !state) {
+        return;
+    }
+
+    if (!state->saturation_running) {
+        if (search->running) {
+            SDL_Log("Saturation search stopped");
+            search->running = SDL_FALSE;
+            search->scene = -1;
+        }
+        return;
+    }
+
+    if (!search->running) {
+        const int first = rs_saturation_next_scene(-1);
+        if (first < 0) {
+            state->saturation_running = SDL_FALSE;
+            return;
+        }
+        search->running = SDL_TRUE;
+        rs_saturation_begin_scene(search, first);
+        SDL_Log("Saturation search started: p95 <= %.1fms (%d FPS)",
+                rs_saturation_target_ms(state->saturation_target),
+                rs_saturation_target_fps(state->saturation_target));
+    } else if (frame_scene == search->scene && frame_level == search->level) {
+        if (search->warmup > 0) {
+            search->warmup--;
+        } else {
+            search->frame_ms[search->samples++] = frame_ms;
+            search->total_ms += frame_ms;
+            if (frame_metrics) {
+                search->draw_calls += frame_metrics->draw_calls;
+                search->vertices += frame_metrics->vertices_rendered;
+            }
+            if (frame_ms > rs_saturation_target_ms(state->saturation_target)) {
+                search->over_target++;
+            }
+
+            // Once more than 5% of the window is over budget the p95 cannot come back
+            const SDL_bool missed =
+                search->over_target > (int)((1.0 - SATURATION_PERCENTILE) * RS_SATURATION_SAMPLES);
+            if (missed || search->samples == RS_SATURATION_SAMPLES) {
+                rs_saturation_finish_probe(search, state, rs_saturation_p95(search));
+            }
+        }
+    }
+
+    if (search->running) {
+        state->auto_cycle = SDL_FALSE;
+        state->saturation_probe_level = search->level;
+        if ((int)state->active_scene == search->scene) {
+            state->stress_level = search->level;
+        } else {
+            // The level is applied once the registry has switched, so the scene
+            // being left keeps the level it was given above
+            state->active_scene = (SceneKind)search->scene;
+        }
+    }
+}
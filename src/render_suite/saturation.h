@@ -0,0 +1,51 @@
+#ifndef RENDER_SUITE_SATURATION_H
+#define RENDER_SUITE_SATURATION_H
+
+#include <SDL2/SDL.h>
+
+#include "bench_common.h"
+#include "render_suite/state.h"
+
+#define RS_SATURATION_SAMPLES 90 // Frames timed per probe once warm-up is over
+
+/*
+ * Finds, per scene, the highest stress level whose p95 frame time stays
+ * within the selected target. Levels are probed 1, 2, 4, ... until one
+ * misses, then bisected between the last pass and the first miss. Scenes
+ * with a single stress level have nothing to search and are skipped.
+ */
+typedef struct {
+    SDL_bool running;
+    int scene;
+    int level;                // Level under test
+    int pass;                 // Highest level that met the target, 0 if none yet
+    int fail;                 // Lowest level that missed, stress_max + 1 if none yet
+    int warmup;               // Matching frames still to discard
+    int samples;
+    int over_target;          // Samples above the target so far
+    double frame_ms[RS_SATURATION_SAMPLES];
+    double total_ms;
+    Uint64 draw_calls;
+    Uint64 vertices;
+    RSSaturationResult best;  // Throughput at `pass`
+} RSSaturationSearch;
+
+double rs_saturation_target_ms(int target);
+int rs_saturation_target_fps(int target);
+
+void rs_saturation_init(RSSaturationSearch *search);
+
+/*
+ * Call once per frame before the scene registry switches scenes. The frame
+ * being reported was drawn by `frame_scene` at `frame_level`; frames that
+ * do not match the probe in progress are ignored. While a search runs it
+ * owns state->active_scene and state->stress_level.
+ */
+void rs_saturation_update(RSSaturationSearch *search,
+                          RenderSuiteState *state,
+                          int frame_scene,
+                          int frame_level,
+                          double frame_ms,
+                          const BenchMetrics *frame_metrics);
+
+#endif /* RENDER_SUITE_SATURATION_H */
@@ -0,0 +1,423 @@
+#include "render_suite/scaler.h"
+#include "render_suite/render_neon.h"
+
+#include <stdlib.h>
+
+// Column maps and the two horizontally scaled rows used by the bilinear pass
+typedef struct {
+    int *x0;
+    int *x1;
+    Uint8 *weight;
+    Uint32 *rows[2];
+    int capacity;
+} ScalerScratch;
+
+static ScalerScratch g_scaler_scratch = {0};
+
+static SDL_bool rs_scaler_reserve(int width)
+{
+    if (width <= g_scaler_scratch.capacity) {
+        return SDL_TRUE;
+    }
+
+    rs_scaler_cleanup();
+    g_scaler_scratch.x0 = malloc(sizeof(int) * (size_t)width);
+    g_scaler_scratch.x1 = malloc(sizeof(int) * (size_t)width);
+    g_scaler_scratch.weight = malloc((size_t)width);
+    g_scaler_scratch.rows[0] = malloc(sizeof(Uint32) * (size_t)width);
+    g_scaler_scratch.rows[1] = malloc(sizeof(Uint32) * (size_t)width);
+    if (!g_scaler_scratch.x0 || !g_scaler_scratch.x1 || !g_scaler_scratch.weight ||
+        !g_scaler_scratch.rows[0] || !g_scaler_scratch.rows[1]) {
+        rs_scaler_cleanup();
+        return SDL_FALSE;
+    }
+    g_scaler_scratch.capacity = width;
+    return SDL_TRUE;
+}
+
+void rs_scaler_cleanup(void)
+{
+    free(g_scaler_scratch.x0);
+    free(g_scaler_scratch.x1);
+    free(g_scaler_scratch.weight);
+    free(g_scaler_scratch.rows[0]);
+    free(g_scaler_scratch.rows[1]);
+    SDL_memset(&g_scaler_scratch, 0, sizeof(g_scaler_scratch));
+}
+
+const char *rs_scaler_name(RSScalerKind kind)
+{
+    static const char *names[RS_SCALER_KIND_MAX] = {
+        "Nearest",
+        "Bilinear",
+        "Integer"
+    };
+    return (kind >= 0 && kind < RS_SCALER_KIND_MAX) ? names[kind] : "Unknown";
+}
+
+const char *rs_scaler_variant_name(RSScalerVariant variant)
+{
+    if (variant == RS_SCALER_SIMD) {
+        return RS_HAS_NEON ? "NEON" : "SIMD";
+    }
+    return "Scalar";
+}
+
+static SDL_bool rs_scaler_args_valid(const Uint32 *src, int src_w, int src_h,
+                                     const Uint32 *dst, int dst_w, int dst_h)
+{
+    return (src && dst && src_w > 0 && src_h > 0 && dst_w > 0 && dst_h > 0) ? SDL_TRUE : SDL_FALSE;
+}
+
+/* ---- Nearest ------------------------------------------------------------ */
+
+// Plain 16.16 stepping per pixel, recomputed for every output row
+static void rs_scale_nearest_row_scalar(const Uint32 *in, Uint32 *out, int width, Uint32 step)
+{
+    Uint32 fx = step >> 1;
+    for (int x = 0; x < width; ++x) {
+        out[x] = in[fx >> 16];
+        fx += step;
+    }
+}
+
+// The gather itself cannot be vectorised on ARMv7, so the SIMD variant builds
+// the column map once with NEON and the row loop becomes a table lookup.
+static void rs_scale_nearest_map(int *map, int width, Uint32 step)
+{
+    int x = 0;
+#if RS_HAS_NEON
+    static const uint32_t lane_offsets[4] = {0, 1, 2, 3};
+    uint32x4_t fx = vmlaq_n_u32(vdupq_n_u32(step >> 1), vld1q_u32(lane_offsets), step);
+    const uint32x4_t step4 = vdupq_n_u32(step * 4u);
+    for (; x + 4 <= width; x += 4) {
+        vst1q_s32(map + x, vreinterpretq_s32_u32(vshrq_n_u32(fx, 16)));
+        fx = vaddq_u32(fx, step4);
+    }
+#endif
+    for (; x < width; ++x) {
+        map[x] = (int)(((step >> 1) + step * (Uint32)x) >> 16);
+    }
+}
+
+static void rs_scale_nearest_row_mapped(const Uint32 *in, Uint32 *out, const int *map, int width)
+{
+    int x = 0;
+    for (; x + 4 <= width; x += 4) {
+        const Uint32 p0 = in[map[x]];
+        const Uint32 p1 = in[map[x + 1]];
+        const Uint32 p2 = in[map[x + 2]];
+        const Uint32 p3 = in[map[x + 3]];
+        out[x] = p0;
+        out[x + 1] = p1;
+        out[x + 2] = p2;
+        out[x + 3] = p3;
+    }
+    for (; x < width; ++x) {
+        out[x] = in[map[x]];
+    }
+}
+
+void rs_scale_nearest(const Uint32 *src, int src_w, int src_h, int src_pitch,
+                      Uint32 *dst, int dst_w, int dst_h, int dst_pitch,
+                      RSScalerVariant variant)
+{
+    if (!rs_scaler_args_valid(src, src_w, src_h, dst, dst_w, dst_h)) {
+        return;
+    }
+
+    const Uint32 step_x = ((Uint32)src_w << 16) / (Uint32)dst_w;
+    const Uint32 step_y = ((Uint32)src_h << 16) / (Uint32)dst_h;
+    const SDL_bool simd = (variant == RS_SCALER_SIMD && rs_scaler_reserve(dst_w)) ? SDL_TRUE : SDL_FALSE;
+    if (simd) {
+        rs_scale_nearest_map(g_scaler_scratch.x0, dst_w, step_x);
+    }
+
+    Uint32 fy = step_y >> 1;
+    int prev_sy = -1;
+    const Uint32 *prev_row = NULL;
+    for (int y = 0; y < dst_h; ++y, fy += step_y) {
+        const int sy = (int)(fy >> 16);
+        Uint32 *out = dst + (size_t)y * (size_t)dst_pitch;
+
+        // Upscaling repeats source rows; reuse the previous output row
+        if (sy == prev_sy) {
+            if (simd) {
+                rs_neon_copy_u32(out, prev_row, (size_t)dst_w);
+            } else {
+                memcpy(out, prev_row, sizeof(Uint32) * (size_t)dst_w);
+            }
+            continue;
+        }
+
+        const Uint32 *in = src + (size_t)sy * (size_t)src_pitch;
+        if (simd) {
+            rs_scale_nearest_row_mapped(in, out, g_scaler_scratch.x0, dst_w);
+        } else {
+            rs_scale_nearest_row_scalar(in, out, dst_w, step_x);
+        }
+        prev_sy = sy;
+        prev_row = out;
+    }
+}
+
+/* ---- Bilinear ----------------------------------------------------------- */
+
+// Two channels per 32-bit lane; weights sum to 256 so nothing overflows
+static inline Uint32 rs_lerp_swar(Uint32 a, Uint32 b, Uint32 w)
+{
+    const Uint32 iw = 256u - w;
+    const Uint32 rb = (((a & 0x00FF00FFu) * iw + (b & 0x00FF00FFu) * w) >> 8) & 0x00FF00FFu;
+    const Uint32 ag = (((a >> 8) & 0x00FF00FFu) * iw + ((b >> 8) & 0x00FF00FFu) * w) & 0xFF00FF00u;
+    return rb | ag;
+}
+
+// Centre-aligned 16.16 sample positions, clamped to the source edge
+static void rs_bilinear_build_map(int src_len, int dst_len, int *i0, int *i1, Uint8 *weight)
+{
+    const Sint32 step = (Sint32)(((Uint32)src_len << 16) / (Uint32)dst_len);
+    Sint32 f = (step >> 1) - 0x8000;
+    for (int i = 0; i < dst_len; ++i, f += step) {
+        const Sint32 clamped = f < 0 ? 0 : f;
+        const int p = (int)(clamped >> 16);
+        i0[i] = p;
+        i1[i] = (p + 1 < src_len) ? p + 1 : src_len - 1;
+        weight[i] = (Uint8)((clamped >> 8) & 0xFF);
+    }
+}
+
+static void rs_bilinear_hpass_scalar(const Uint32 *in, Uint32 *out, int width)
+{
+    const int *x0 = g_scaler_scratch.x0;
+    const int *x1 = g_scaler_scratch.x1;
+    const Uint8 *w = g_scaler_scratch.weight;
+    for (int x = 0; x < width; ++x) {
+        out[x] = rs_lerp_swar(in[x0[x]], in[x1[x]], w[x]);
+    }
+}
+
+static void rs_bilinear_vpass_scalar(const Uint32 *a, const Uint32 *b, Uint32 *out, int width, Uint32 w)
+{
+    for (int x = 0; x < width; ++x) {
+        out[x] = rs_lerp_swar(a[x], b[x], w);
+    }
+}
+
+#if RS_HAS_NEON
+static void rs_bilinear_hpass_neon(const Uint32 *in, Uint32 *out, int width)
+{
+    const int *x0 = g_scaler_scratch.x0;
+    const int *x1 = g_scaler_scratch.x1;
+    const Uint8 *w = g_scaler_scratch.weight;
+    const uint16x8_t full = vdupq_n_u16(256);
+    int x = 0;
+    for (; x + 2 <= width; x += 2) {
+        uint32x2_t pa = vdup_n_u32(in[x0[x]]);
+        uint32x2_t pb = vdup_n_u32(in[x1[x]]);
+        pa = vset_lane_u32(in[x0[x + 1]], pa, 1);
+        pb = vset_lane_u32(in[x1[x + 1]], pb, 1);
+
+        const uint16x8_t wb = vcombine_u16(vdup_n_u16(w[x]), vdup_n_u16(w[x + 1]));
+        const uint16x8_t wa = vsubq_u16(full, wb);
+        uint16x8_t acc = vmulq_u16(vmovl_u8(vreinterpret_u8_u32(pa)), wa);
+        acc = vmlaq_u16(acc, vmovl_u8(vreinterpret_u8_u32(pb)), wb);
+        vst1_u32(out + x, vreinterpret_u32_u8(vshrn_n_u16(acc, 8)));
+    }
+    for (; x < width; ++x) {
+        out[x] = rs_lerp_swar(in[x0[x]], in[x1[x]], w[x]);
+    }
+}
+
+static void rs_bilinear_vpass_neon(const Uint32 *a, const Uint32 *b, Uint32 *out, int width, Uint32 w)
+{
+    const uint8x8_t wb = vdup_n_u8((uint8_t)w);
+    const uint8x8_t wa = vdup_n_u8((uint8_t)(256u - w));
+    int x = 0;
+    for (; x + 4 <= width; x += 4) {
+        const uint8x16_t va = vreinterpretq_u8_u32(vld1q_u32(a + x));
+        const uint8x16_t vb = vreinterpretq_u8_u32(vld1q_u32(b + x));
+        uint16x8_t lo = vmull_u8(vget_low_u8(va), wa);
+        uint16x8_t hi = vmull_u8(vget_high_u8(va), wa);
+        lo = vmlal_u8(lo, vget_low_u8(vb), wb);
+        hi = vmlal_u8(hi, vget_high_u8(vb), wb);
+        const uint8x16_t res = vcombine_u8(vshrn_n_u16(lo, 8), vshrn_n_u16(hi, 8));
+        vst1q_u32(out + x, vreinterpretq_u32_u8(res));
+    }
+    for (; x < width; ++x) {
+        out[x] = rs_lerp_swar(a[x], b[x], w);
+    }
+}
+#endif
+
+static int rs_bilinear_row_slot(const int keys[2], int row)
+{
+    if (keys[0] == row) {
+        return 0;
+    }
+    if (keys[1] == row) {
+        return 1;
+    }
+    return -1;
+}
+
+void rs_scale_bilinear(const Uint32 *src, int src_w, int src_h, int src_pitch,
+                       Uint32 *dst, int dst_w, int dst_h, int dst_pitch,
+                       RSScalerVariant variant)
+{
+    if (!rs_scaler_args_valid(src, src_w, src_h, dst, dst_w, dst_h) || !rs_scaler_reserve(dst_w)) {
+        return;
+    }
+
+    void (*hpass)(const Uint32 *, Uint32 *, int) = rs_bilinear_hpass_scalar;
+    void (*vpass)(const Uint32 *, const Uint32 *, Uint32 *, int, Uint32) = rs_bilinear_vpass_scalar;
+#if RS_HAS_NEON
+    if (variant == RS_SCALER_SIMD) {
+        hpass = rs_bilinear_hpass_neon;
+        vpass = rs_bilinear_vpass_neon;
+    }
+#else
+    (void)variant;
+#endif
+
+    rs_bilinear_build_map(src_w, dst_w, g_scaler_scratch.x0, g_scaler_scratch.x1, g_scaler_scratch.weight);
+
+    // Separable: each source row is scaled horizontally once and kept while
+    // consecutive output rows still sample it.
+    int keys[2] = {-1, -1};
+    const Sint32 step_y = (Sint32)(((Uint32)src_h << 16) / (Uint32)dst_h);
+    Sint32 fy = (step_y >> 1) - 0x8000;
+    for (int y = 0; y < dst_h; ++y, fy += step_y) {
+        const Sint32 clamped = fy < 0 ? 0 : fy;
+        const int y0 = (int)(clamped >> 16);
+        const int y1 = (y0 + 1 < src_h) ? y0 + 1 : src_h - 1;
+        const Uint32 wy = (Uint32)((clamped >> 8) & 0xFF);
+
+        int a = rs_bilinear_row_slot(keys, y0);
+        if (a < 0) {
+            a = (keys[0] == y1) ? 1 : 0;
+            hpass(src + (size_t)y0 * (size_t)src_pitch, g_scaler_scratch.rows[a], dst_w);
+            keys[a] = y0;
+        }
+
+        Uint32 *out = dst + (size_t)y * (size_t)dst_pitch;
+        if (wy == 0) {
+            rs_neon_copy_u32(out, g_scaler_scratch.rows[a], (size_t)dst_w);
+            continue;
+        }
+
+        int b = rs_bilinear_row_slot(keys, y1);
+        if (b < 0) {
+            b = a ^ 1;
+            hpass(src + (size_t)y1 * (size_t)src_pitch, g_scaler_scratch.rows[b], dst_w);
+            keys[b] = y1;
+        }
+
+        vpass(g_scaler_scratch.rows[a], g_scaler_scratch.rows[b], out, dst_w, wy);
+    }
+}
+
+/* ---- Integer ------------------------------------------------------------ */
+
+int rs_scale_integer_factor(int src_w, int src_h, int dst_w, int dst_h)
+{
+    for (int factor = 3; factor > 1; --factor) {
+        if (src_w * factor <= dst_w && src_h * factor <= dst_h) {
+            return factor;
+        }
+    }
+    return 1;
+}
+
+static void rs_scale_integer_row_scalar(const Uint32 *in, Uint32 *out, int width, int factor)
+{
+    switch (factor) {
+        case 3:
+            for (int x = 0; x < width; ++x) {
+                const Uint32 p = in[x];
+                out[0] = p;
+                out[1] = p;
+                out[2] = p;
+                out += 3;
+            }
+            break;
+        case 2:
+            for (int x = 0; x < width; ++x) {
+                const Uint32 p = in[x];
+                out[0] = p;
+                out[1] = p;
+                out += 2;
+            }
+            break;
+        default:
+            memcpy(out, in, sizeof(Uint32) * (size_t)width);
+            break;
+    }
+}
+
+#if RS_HAS_NEON
+// Interleaving stores write each loaded pixel 2 or 3 times in one instruction
+static void rs_scale_integer_row_neon(const Uint32 *in, Uint32 *out, int width, int factor)
+{
+    int x = 0;
+    if (factor == 2) {
+        for (; x + 4 <= width; x += 4) {
+            const uint32x4_t v = vld1q_u32(in + x);
+            uint32x4x2_t pair;
+            pair.val[0] = v;
+            pair.val[1] = v;
+            vst2q_u32(out + x * 2, pair);
+        }
+    } else if (factor == 3) {
+        for (; x + 4 <= width; x += 4) {
+            const uint32x4_t v = vld1q_u32(in + x);
+            uint32x4x3_t triple;
+            triple.val[0] = v;
+            triple.val[1] = v;
+            triple.val[2] = v;
+            vst3q_u32(out + x * 3, triple);
+        }
+    } else {
+        rs_neon_copy_u32(out, in, (size_t)width);
+        return;
+    }
+    rs_scale_integer_row_scalar(in + x, out + x * factor, width - x, factor);
+}
+#endif
+
+int rs_scale_integer(const Uint32 *src, int src_w, int src_h, int src_pitch,
+                     Uint32 *dst, int dst_w, int dst_h, int dst_pitch,
+                     RSScalerVariant variant)
+{
+    if (!rs_scaler_args_valid(src, src_w, src_h, dst, dst_w, dst_h)) {
+        return 0;
+    }
+
+    const int factor = rs_scale_integer_factor(src_w, src_h, dst_w, dst_h);
+    if (src_w * factor > dst_w || src_h * factor > dst_h) {
+        return 0;
+    }
+
+    const int out_w = src_w * factor;
+    for (int y = 0; y < src_h; ++y) {
+        const Uint32 *in = src + (size_t)y * (size_t)src_pitch;
+        Uint32 *out = dst + (size_t)y * (size_t)factor * (size_t)dst_pitch;
+
+#if RS_HAS_NEON
+        if (variant == RS_SCALER_SIMD) {
+            rs_scale_integer_row_neon(in, out, src_w, factor);
+            for (int r = 1; r < factor; ++r) {
+                rs_neon_copy_u32(out + (size_t)r * (size_t)dst_pitch, out, (size_t)out_w);
+            }
+            continue;
+        }
+#else
+        (void)variant;
+#endif
+        rs_scale_integer_row_scalar(in, out, src_w, factor);
+        for (int r = 1; r < factor; ++r) {
+            memcpy(out + (size_t)r * (size_t)dst_pitch, out, sizeof(Uint32) * (size_t)out_w);
+        }
+    }
+
+    return factor;
+}
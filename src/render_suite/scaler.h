@@ -0,0 +1,45 @@
+#ifndef RENDER_SUITE_SCALER_H
+#define RENDER_SUITE_SCALER_H
+
+#include <SDL2/SDL.h>
+
+typedef enum {
+    RS_SCALER_NEAREST = 0,
+    RS_SCALER_BILINEAR,
+    RS_SCALER_INTEGER,
+    RS_SCALER_KIND_MAX
+} RSScalerKind;
+
+typedef enum {
+    RS_SCALER_SCALAR = 0,
+    RS_SCALER_SIMD,
+    RS_SCALER_VARIANT_MAX
+} RSScalerVariant;
+
+/*
+ * CPU image scalers for 32-bit pixels. Pitches are given in pixels, not
+ * bytes. The SIMD variant falls back to the scalar code on builds without
+ * NEON so both variants are always callable.
+ */
+void rs_scale_nearest(const Uint32 *src, int src_w, int src_h, int src_pitch,
+                      Uint32 *dst, int dst_w, int dst_h, int dst_pitch,
+                      RSScalerVariant variant);
+
+void rs_scale_bilinear(const Uint32 *src, int src_w, int src_h, int src_pitch,
+                       Uint32 *dst, int dst_w, int dst_h, int dst_pitch,
+                       RSScalerVariant variant);
+
+// Largest whole factor (1-3) at which src fits inside dst.
+int rs_scale_integer_factor(int src_w, int src_h, int dst_w, int dst_h);
+
+// Writes a src_w*factor x src_h*factor image at dst; returns the factor used.
+int rs_scale_integer(const Uint32 *src, int src_w, int src_h, int src_pitch,
+                     Uint32 *dst, int dst_w, int dst_h, int dst_pitch,
+                     RSScalerVariant variant);
+
+const char *rs_scaler_name(RSScalerKind kind);
+const char *rs_scaler_variant_name(RSScalerVariant variant);
+
+void rs_scaler_cleanup(void);
+
+#endif /* RENDER_SUITE_SCALER_H */
@@ -0,0 +1,151 @@
+#include "render_suite/scene_registry.h"
+
+#include "render_suite/scenes/bandwidth.h"
+#include "render_suite/scenes/convert.h"
+#include "render_suite/scenes/fill.h"
+#include "render_suite/scenes/geometry.h"
+#include "render_suite/scenes/lines.h"
+#include "render_suite/scenes/memory.h"
+#include "render_suite/scenes/pixels.h"
+#include "render_suite/scenes/scaling.h"
+#include "render_suite/scenes/texture.h"
+#include "render_suite/scenes/upload.h"
+
+static const RSSceneDesc scene_table[SCENE_MAX] = {
+    [SCENE_FILL] = {
+        "Fill Rate", NULL, rs_scene_fill, rs_scene_fill_cleanup, rs_scene_fill_report,
+        1, RS_STRESS_LEVEL_MAX, SDL_TRUE
+    },
+    [SCENE_TEXTURE] = {
+        "Texture", rs_scene_texture_init, rs_scene_texture, rs_scene_texture_cleanup, NULL,
+        1, RS_STRESS_LEVEL_MAX, SDL_TRUE
+    },
+    [SCENE_LINES] = {
+        "Lines/Geometry", NULL, rs_scene_lines, rs_scene_lines_cleanup, rs_scene_lines_report,
+        1, RS_STRESS_LEVEL_MAX, SDL_TRUE
+    },
+    [SCENE_GEOMETRY] = {
+        "3D Geometry", NULL, rs_scene_geometry, NULL, NULL,
+        1, RS_STRESS_LEVEL_MAX, SDL_TRUE
+    },
+    [SCENE_SCALING] = {
+        "Resolution Scaling", rs_scene_scaling_init, rs_scene_scaling, rs_scene_scaling_cleanup,
+        rs_scene_scaling_report,
+        1, RS_STRESS_LEVEL_MAX, SDL_TRUE
+    },
+    [SCENE_MEMORY] = {
+        "Memory Management", rs_scene_memory_init, rs_scene_memory, rs_scene_memory_cleanup, NULL,
+        1, RS_STRESS_LEVEL_MAX, SDL_TRUE
+    },
+    [SCENE_PIXELS] = {
+        "Pixel Operations", rs_scene_pixels_init, rs_scene_pixels, rs_scene_pixels_cleanup,
+        rs_scene_pixels_report,
+        1, RS_STRESS_LEVEL_MAX, SDL_TRUE
+    },
+    [SCENE_CONVERT] = {
+        "Format Conversion", rs_scene_convert_init, rs_scene_convert, rs_scene_convert_cleanup,
+        rs_scene_convert_report,
+        1, 1, SDL_FALSE
+    },
+    [SCENE_BANDWIDTH] = {
+        "Memory Bandwidth", NULL, rs_scene_bandwidth, rs_scene_bandwidth_cleanup, NULL,
+        1, 1, SDL_FALSE
+    },
+    [SCENE_UPLOAD] = {
+        "Texture Upload", rs_scene_upload_init, rs_scene_upload, rs_scene_upload_cleanup,
+        rs_scene_upload_report,
+        1, 1, SDL_FALSE
+    },
+};
+
+const RSSceneDesc *rs_scene_desc(SceneKind kind)
+{
+    return &scene_table[SDL_clamp((int)kind, 0, SCENE_MAX - 1)];
+}
+
+SceneKind rs_scene_auto_cycle(int step)
+{
+    int count = 0;
+    for (int i = 0; i < SCENE_MAX; ++i) {
+        count += scene_table[i].auto_cycle ? 1 : 0;
+    }
+    if (count == 0) {
+        return SCENE_FILL;
+    }
+
+    int remaining = step % count;
+    for (int i = 0; i < SCENE_MAX; ++i) {
+        if (scene_table[i].auto_cycle && remaining-- == 0) {
+            return (SceneKind)i;
+        }
+    }
+    return SCENE_FILL;
+}
+
+void rs_scene_registry_init(RSSceneRegistry *registry)
+{
+    SDL_memset(registry, 0, sizeof(*registry));
+    registry->live = -1;
+    for (int i = 0; i < SCENE_MAX; ++i) {
+        bench_reset_metrics(&registry->metrics[i]);
+    }
+}
+
+SDL_bool rs_scene_registry_enter(RSSceneRegistry *registry, RenderSuiteState *state, SDL_Renderer *renderer)
+{
+    const int next = SDL_clamp((int)state->active_scene, 0, SCENE_MAX - 1);
+    if (next == registry->live) {
+        return SDL_FALSE;
+    }
+
+    if (registry->live >= 0) {
+        const RSSceneDesc *live = &scene_table[registry->live];
+        registry->stress[registry->live] = state->stress_level;
+        if (live->teardown) {
+            live->teardown(state);
+        }
+    }
+
+    const RSSceneDesc *desc = &scene_table[next];
+    if (!registry->visited[next]) {
+        // First visit starts from the current level, limited to what the scene accepts
+        registry->stress[next] = SDL_clamp(state->stress_level, desc->stress_min, desc->stress_max);
+        registry->visited[next] = SDL_TRUE;
+    }
+    state->stress_level = registry->stress[next];
+    if (desc->init) {
+        desc->init(state, renderer);
+    }
+    registry->live = next;
+    return SDL_TRUE;
+}
+
+BenchMetrics *rs_scene_registry_metrics(RSSceneRegistry *registry, SceneKind kind)
+{
+    return &registry->metrics[SDL_clamp((int)kind, 0, SCENE_MAX - 1)];
+}
+
+void rs_scene_registry_shutdown(RSSceneRegistry *registry, RenderSuiteState *state)
+{
+    if (registry->live >= 0 && scene_table[registry->live].teardown) {
+        scene_table[registry->live].teardown(state);
+    }
+    registry->live = -1;
+
+    for (int i = 0; i < SCENE_MAX; ++i) {
+        const RSSceneDesc *desc = &scene_table[i];
+        if (!registry->visited[i]) {
+            continue;
+        }
+        const BenchMetrics *metrics = &registry->metrics[i];
+        SDL_Log("Scene %-18s: %llu frames | avg %.1f fps | frame %.3f-%.3fms",
+                desc->name,
+                (unsigned long long)metrics->frame_count,
+                metrics->avg_fps,
+                metrics->frame_count ? metrics->min_frame_time_ms : 0.0,
+                metrics->max_frame_time_ms);
+        if (desc->report) {
+            desc->report(state);
+        }
+    }
+}
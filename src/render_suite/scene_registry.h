@@ -0,0 +1,49 @@
+#ifndef RENDER_SUITE_SCENE_REGISTRY_H
+#define RENDER_SUITE_SCENE_REGISTRY_H
+
+#include <SDL2/SDL.h>
+
+#include "bench_common.h"
+#include "render_suite/state.h"
+
+/*
+ * Everything main.c needs to run a scene. init/teardown may be NULL and only
+ * bracket the time a scene is on screen: teardown frees what init made but
+ * leaves the scene's accumulated stats in RenderSuiteState, so report can
+ * log the whole run at exit.
+ */
+typedef struct {
+    const char *name;
+    void (*init)(RenderSuiteState *state, SDL_Renderer *renderer);
+    void (*frame)(RenderSuiteState *state, SDL_Renderer *renderer, BenchMetrics *metrics, double delta_seconds);
+    void (*teardown)(RenderSuiteState *state);
+    void (*report)(const RenderSuiteState *state);
+    int stress_min;
+    int stress_max;                   // Equal to stress_min for scenes that ignore stress
+    SDL_bool auto_cycle;              // Part of the A rotation; probe scenes are only entered by hand
+} RSSceneDesc;
+
+typedef struct {
+    int live;                         // Scene whose resources are resident, -1 for none
+    BenchMetrics metrics[SCENE_MAX];  // Frame stats kept apart per scene
+    int stress[SCENE_MAX];            // Stress level each scene was left at
+    SDL_bool visited[SCENE_MAX];
+} RSSceneRegistry;
+
+const RSSceneDesc *rs_scene_desc(SceneKind kind);
+
+// Scene shown `step` slots into the auto-cycle rotation
+SceneKind rs_scene_auto_cycle(int step);
+
+void rs_scene_registry_init(RSSceneRegistry *registry);
+
+// Tears down the live scene and initialises state->active_scene if they
+// differ. Returns SDL_TRUE when a switch happened.
+SDL_bool rs_scene_registry_enter(RSSceneRegistry *registry, RenderSuiteState *state, SDL_Renderer *renderer);
+
+BenchMetrics *rs_scene_registry_metrics(RSSceneRegistry *registry, SceneKind kind);
+
+// Tears down the live scene and reports every scene that was visited
+void rs_scene_registry_shutdown(RSSceneRegistry *registry, RenderSuiteState *state);
+
+#endif /* RENDER_SUITE_SCENE_REGISTRY_H */
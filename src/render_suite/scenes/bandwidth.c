@@ -0,0 +1,401 @@
+#include "render_suite/scenes/bandwidth.h"
+#include "render_suite/render_neon.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include "common/memory_opt.h"
+
+#define BANDWIDTH_MIN_BYTES 4096
+#define BANDWIDTH_LINE_WORDS 16      // 64-byte cache line in Uint32s
+#define BANDWIDTH_STEP_MS 8.0        // Each measurement repeats until it spans this long
+#define BANDWIDTH_MAX_REPS (1 << 20)
+#define BANDWIDTH_KNEE_RATIO 2.0     // Latency jump that counts as leaving a cache level
+#define BANDWIDTH_CSV_NAME "memory_bandwidth.csv"
+
+// Measurements per working set: every bandwidth test plus the latency chase
+#define BANDWIDTH_STEPS_PER_SIZE (RS_BANDWIDTH_TEST_MAX + 1)
+
+static const char *bandwidth_test_names[RS_BANDWIDTH_TEST_MAX] = {
+    "read",
+    "write",
+    "memcpy",
+    "rs_neon_copy_u32",
+    "neon_memcpy"
+};
+
+/*
+ * One buffer holds every working set: tests use its first `bytes`, copies
+ * move the first half onto the second. It only lives for the length of a
+ * sweep, so the rest of the suite does not pay for 32 MiB it never uses.
+ */
+typedef struct {
+    Uint32 *buffer;
+    size_t bytes;
+} BandwidthProbe;
+
+static BandwidthProbe g_bandwidth_probe;
+static volatile Uint32 g_bandwidth_sink; // Keeps reads and the chase from being optimised out
+
+static size_t rs_bandwidth_size(int index)
+{
+    return (size_t)BANDWIDTH_MIN_BYTES << index;
+}
+
+static double rs_bandwidth_elapsed_ms(Uint64 start)
+{
+    return (double)(SDL_GetPerformanceCounter() - start) / (double)SDL_GetPerformanceFrequency() * 1000.0;
+}
+
+static Uint32 rs_bandwidth_read(const Uint32 *src, size_t words)
+{
+    size_t i = 0;
+    Uint32 sum = 0;
+#if RS_HAS_NEON
+    uint32x4_t acc0 = vdupq_n_u32(0);
+    uint32x4_t acc1 = vdupq_n_u32(0);
+    uint32x4_t acc2 = vdupq_n_u32(0);
+    uint32x4_t acc3 = vdupq_n_u32(0);
+    for (; i + 16 <= words; i += 16) {
+        acc0 = vaddq_u32(acc0, vld1q_u32(src + i));
+        acc1 = vaddq_u32(acc1, vld1q_u32(src + i + 4));
+        acc2 = vaddq_u32(acc2, vld1q_u32(src + i + 8));
+        acc3 = vaddq_u32(acc3, vld1q_u32(src + i + 12));
+    }
+    Uint32 lanes[4];
+    vst1q_u32(lanes, vaddq_u32(vaddq_u32(acc0, acc1), vaddq_u32(acc2, acc3)));
+    sum = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+#else
+    Uint32 acc[4] = {0, 0, 0, 0};
+    for (; i + 4 <= words; i += 4) {
+        acc[0] += src[i];
+        acc[1] += src[i + 1];
+        acc[2] += src[i + 2];
+        acc[3] += src[i + 3];
+    }
+    sum = acc[0] + acc[1] + acc[2] + acc[3];
+#endif
+    for (; i < words; ++i) {
+        sum += src[i];
+    }
+    return sum;
+}
+
+static void rs_bandwidth_run(int test, Uint32 *buffer, size_t bytes)
+{
+    const size_t words = bytes / sizeof(Uint32);
+    const size_t half = words / 2;
+    switch (test) {
+        case RS_BANDWIDTH_READ:
+            g_bandwidth_sink += rs_bandwidth_read(buffer, words);
+            break;
+        case RS_BANDWIDTH_WRITE:
+            rs_neon_fill_u32(buffer, g_bandwidth_sink, words);
+            break;
+        case RS_BANDWIDTH_COPY_MEMCPY:
+            memcpy(buffer + half, buffer, half * sizeof(Uint32));
+            break;
+        case RS_BANDWIDTH_COPY_NEON_U32:
+            rs_neon_copy_u32(buffer + half, buffer, half);
+            break;
+        case RS_BANDWIDTH_COPY_NEON_MEMCPY:
+            rs_memcpy(buffer + half, buffer, half * sizeof(Uint32));
+            break;
+        default:
+            break;
+    }
+}
+
+// MB/s (10^6 bytes) moved; copies count the bytes copied, i.e. half the working set
+static double rs_bandwidth_measure(int test, Uint32 *buffer, size_t bytes)
+{
+    const size_t moved = (test >= RS_BANDWIDTH_COPY_MEMCPY) ? bytes / 2 : bytes;
+    for (int reps = 1;; reps *= 2) {
+        const Uint64 start = SDL_GetPerformanceCounter();
+        for (int r = 0; r < reps; ++r) {
+            rs_bandwidth_run(test, buffer, bytes);
+        }
+        const double ms = rs_bandwidth_elapsed_ms(start);
+        if (ms >= BANDWIDTH_STEP_MS || reps >= BANDWIDTH_MAX_REPS) {
+            return ms > 0.0 ? (double)moved * (double)reps / (ms * 1000.0) : 0.0;
+        }
+    }
+}
+
+/*
+ * Links every cache line of the working set into one random cycle (Sattolo's
+ * shuffle) and times dependent loads around it, so neither the prefetcher nor
+ * out-of-order issue can hide the latency of the level the set lives in.
+ */
+static double rs_bandwidth_latency(Uint32 *buffer, size_t bytes)
+{
+    const size_t lines = bytes / (BANDWIDTH_LINE_WORDS * sizeof(Uint32));
+    if (lines < 2) {
+        return 0.0;
+    }
+
+    for (size_t i = 0; i < lines; ++i) {
+        buffer[i * BANDWIDTH_LINE_WORDS] = (Uint32)i;
+    }
+    Uint32 seed = 0x9E3779B9u;
+    for (size_t i = lines - 1; i > 0; --i) {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        const size_t j = seed % i;
+        const Uint32 tmp = buffer[i * BANDWIDTH_LINE_WORDS];
+        buffer[i * BANDWIDTH_LINE_WORDS] = buffer[j * BANDWIDTH_LINE_WORDS];
+        buffer[j * BANDWIDTH_LINE_WORDS] = tmp;
+    }
+
+    Uint32 index = 0;
+    for (size_t steps = lines;; steps *= 2) {
+        const Uint64 start = SDL_GetPerformanceCounter();
+        for (size_t s = 0; s < steps; ++s) {
+            index = buffer[(size_t)index * BANDWIDTH_LINE_WORDS];
+        }
+        const double ms = rs_bandwidth_elapsed_ms(start);
+        if (ms >= BANDWIDTH_STEP_MS || steps >= (size_t)BANDWIDTH_MAX_REPS * 16) {
+            g_bandwidth_sink += index;
+            return ms * 1000000.0 / (double)steps;
+        }
+    }
+}
+
+static SDL_bool rs_bandwidth_alloc(RenderSuiteState *state)
+{
+    BandwidthProbe *probe = &g_bandwidth_probe;
+    // Fall back to smaller sweeps rather than failing on a tight heap
+    for (int sizes = RS_BANDWIDTH_SIZES; sizes > 0 && !probe->buffer; --sizes) {
+        probe->bytes = rs_bandwidth_size(sizes - 1);
+        probe->buffer = malloc(probe->bytes);
+        state->bandwidth_sizes = sizes;
+    }
+    if (!probe->buffer) {
+        probe->bytes = 0;
+        state->bandwidth_sizes = 0;
+        return SDL_FALSE;
+    }
+    // Fault every page in now so the first write test does not time page faults
+    rs_neon_fill_u32(probe->buffer, 0, probe->bytes / sizeof(Uint32));
+    return SDL_TRUE;
+}
+
+static void rs_bandwidth_free(void)
+{
+    free(g_bandwidth_probe.buffer);
+    SDL_memset(&g_bandwidth_probe, 0, sizeof(g_bandwidth_probe));
+}
+
+static void rs_bandwidth_find_knees(RenderSuiteState *state)
+{
+    state->bandwidth_knee_count = 0;
+    double base = state->bandwidth_latency_ns[0];
+    for (int i = 1; i < state->bandwidth_sizes && state->bandwidth_knee_count < RS_BANDWIDTH_KNEES; ++i) {
+        const double latency = state->bandwidth_latency_ns[i];
+        if (base > 0.0 && latency > base * BANDWIDTH_KNEE_RATIO) {
+            state->bandwidth_knee_bytes[state->bandwidth_knee_count++] = (int)rs_bandwidth_size(i - 1);
+            base = latency;
+        }
+    }
+}
+
+// Logs the sweep and writes it as CSV next to the binary
+static void rs_bandwidth_export(RenderSuiteState *state)
+{
+    char *base_path = SDL_GetBasePath();
+    char path[512];
+    SDL_snprintf(path, sizeof(path), "%s%s", base_path ? base_path : "", BANDWIDTH_CSV_NAME);
+    SDL_free(base_path);
+
+    SDL_RWops *csv = SDL_RWFromFile(path, "w");
+    char line[256];
+    int length = SDL_snprintf(line, sizeof(line), "bytes");
+    for (int test = 0; test < RS_BANDWIDTH_TEST_MAX; ++test) {
+        length += SDL_snprintf(line + length, sizeof(line) - (size_t)length, ",%s_mbps",
+                               bandwidth_test_names[test]);
+    }
+    SDL_snprintf(line + length, sizeof(line) - (size_t)length, ",latency_ns\n");
+    if (csv) {
+        SDL_RWwrite(csv, line, 1, SDL_strlen(line));
+    }
+
+    for (int i = 0; i < state->bandwidth_sizes; ++i) {
+        length = SDL_snprintf(line, sizeof(line), "%u", (unsigned int)rs_bandwidth_size(i));
+        for (int test = 0; test < RS_BANDWIDTH_TEST_MAX; ++test) {
+            length += SDL_snprintf(line + length, sizeof(line) - (size_t)length, ",%.1f",
+                                   state->bandwidth_mbps[test][i]);
+        }
+        SDL_snprintf(line + length, sizeof(line) - (size_t)length, ",%.2f\n", state->bandwidth_latency_ns[i]);
+        SDL_Log("Bandwidth %.*s", (int)SDL_strlen(line) - 1, line); // Without the newline
+        if (csv) {
+            SDL_RWwrite(csv, line, 1, SDL_strlen(line));
+        }
+    }
+
+    for (int k = 0; k < state->bandwidth_knee_count; ++k) {
+        SDL_Log("Bandwidth knee %d: latency jumps past %d KiB", k + 1, state->bandwidth_knee_bytes[k] / 1024);
+    }
+    if (csv) {
+        SDL_RWclose(csv);
+        SDL_Log("Bandwidth sweep written to %s", path);
+    } else {
+        SDL_Log("Bandwidth sweep: could not write %s: %s", path, SDL_GetError());
+    }
+    state->bandwidth_exported = SDL_TRUE;
+}
+
+// One measurement per frame keeps the overlay responsive during a sweep
+static void rs_bandwidth_step(RenderSuiteState *state)
+{
+    if (state->bandwidth_step == 0) {
+        SDL_memset(state->bandwidth_mbps, 0, sizeof(state->bandwidth_mbps));
+        SDL_memset(state->bandwidth_latency_ns, 0, sizeof(state->bandwidth_latency_ns));
+        state->bandwidth_knee_count = 0;
+        state->bandwidth_exported = SDL_FALSE;
+        rs_bandwidth_free();
+    }
+    if (!g_bandwidth_probe.buffer && !rs_bandwidth_alloc(state)) {
+        return;
+    }
+
+    const int size_index = state->bandwidth_step / BANDWIDTH_STEPS_PER_SIZE;
+    const int test = state->bandwidth_step % BANDWIDTH_STEPS_PER_SIZE;
+    const size_t bytes = rs_bandwidth_size(size_index);
+    if (test < RS_BANDWIDTH_TEST_MAX) {
+        state->bandwidth_mbps[test][size_index] = rs_bandwidth_measure(test, g_bandwidth_probe.buffer, bytes);
+    } else {
+        state->bandwidth_latency_ns[size_index] = rs_bandwidth_latency(g_bandwidth_probe.buffer, bytes);
+    }
+    state->bandwidth_step++;
+
+    if (state->bandwidth_step >= state->bandwidth_sizes * BANDWIDTH_STEPS_PER_SIZE) {
+        rs_bandwidth_free();
+        rs_bandwidth_find_knees(state);
+        rs_bandwidth_export(state);
+    }
+}
+
+/* ---- Plot ---------------------------------------------------------------- */
+
+static const SDL_Color bandwidth_colours[RS_BANDWIDTH_TEST_MAX + 1] = {
+    {0, 200, 255, 255},   // read
+    {0, 255, 160, 255},   // write
+    {255, 180, 120, 255}, // memcpy
+    {255, 90, 220, 255},  // rs_neon_copy_u32
+    {255, 255, 255, 255}, // neon_memcpy
+    {255, 70, 70, 255}    // latency
+};
+
+static float rs_bandwidth_plot_x(const SDL_FRect *area, int index)
+{
+    return area->x + area->w * (float)index / (float)(RS_BANDWIDTH_SIZES - 1);
+}
+
+static void rs_bandwidth_plot_series(SDL_Renderer *renderer,
+                                     const SDL_FRect *area,
+                                     const double *values,
+                                     int count,
+                                     double max_value,
+                                     SDL_Color colour,
+                                     BenchMetrics *metrics)
+{
+    SDL_FPoint points[RS_BANDWIDTH_SIZES];
+    int used = 0;
+    for (int i = 0; i < count && values[i] > 0.0; ++i) {
+        const float t = (float)SDL_min(values[i] / max_value, 1.0);
+        points[used].x = rs_bandwidth_plot_x(area, i);
+        points[used].y = area->y + area->h * (1.0f - t);
+        ++used;
+    }
+    if (used < 2) {
+        return;
+    }
+    SDL_SetRenderDrawColor(renderer, colour.r, colour.g, colour.b, colour.a);
+    SDL_RenderDrawLinesF(renderer, points, used);
+    if (metrics) {
+        metrics->draw_calls++;
+        metrics->vertices_rendered += (Uint64)used;
+    }
+}
+
+/*
+ * Bandwidth curves over the top two thirds, latency under them on a log
+ * scale (1 ns .. 1 us), both against log2 working set. Knees are drawn as
+ * vertical markers across the whole plot.
+ */
+static void rs_bandwidth_plot(const RenderSuiteState *state, SDL_Renderer *renderer, BenchMetrics *metrics)
+{
+    const float top = state->top_margin + 12.0f;
+    const float height = (float)BENCH_SCREEN_H - top - 12.0f;
+    if (height < 60.0f) {
+        return;
+    }
+    const SDL_FRect bandwidth_area = {24.0f, top, (float)BENCH_SCREEN_W - 48.0f, height * 0.62f};
+    const SDL_FRect latency_area = {24.0f, top + height * 0.70f, (float)BENCH_SCREEN_W - 48.0f, height * 0.30f};
+
+    SDL_SetRenderDrawColor(renderer, 60, 70, 90, 255);
+    SDL_RenderDrawRectF(renderer, &bandwidth_area);
+    SDL_RenderDrawRectF(renderer, &latency_area);
+    for (int i = 0; i < RS_BANDWIDTH_SIZES; ++i) {
+        const float x = rs_bandwidth_plot_x(&bandwidth_area, i);
+        SDL_RenderDrawLineF(renderer, x, latency_area.y + latency_area.h, x, latency_area.y + latency_area.h + 4.0f);
+    }
+
+    double max_mbps = 1.0;
+    for (int test = 0; test < RS_BANDWIDTH_TEST_MAX; ++test) {
+        for (int i = 0; i < state->bandwidth_sizes; ++i) {
+            max_mbps = SDL_max(max_mbps, state->bandwidth_mbps[test][i]);
+        }
+    }
+    for (int test = 0; test < RS_BANDWIDTH_TEST_MAX; ++test) {
+        rs_bandwidth_plot_series(renderer, &bandwidth_area, state->bandwidth_mbps[test],
+                                 state->bandwidth_sizes, max_mbps * 1.1, bandwidth_colours[test], metrics);
+    }
+
+    double log_latency[RS_BANDWIDTH_SIZES];
+    for (int i = 0; i < state->bandwidth_sizes; ++i) {
+        // log10(ns) + 1 keeps sub-nanosecond L1 hits above zero
+        log_latency[i] = state->bandwidth_latency_ns[i] > 0.0 ?
+            SDL_max(SDL_log10(state->bandwidth_latency_ns[i]) + 1.0, 0.01) : 0.0;
+    }
+    rs_bandwidth_plot_series(renderer, &latency_area, log_latency, state->bandwidth_sizes, 4.0,
+                             bandwidth_colours[RS_BANDWIDTH_TEST_MAX], metrics);
+
+    SDL_SetRenderDrawColor(renderer, 255, 215, 0, 255);
+    for (int k = 0; k < state->bandwidth_knee_count; ++k) {
+        int index = 0;
+        while (index < RS_BANDWIDTH_SIZES - 1 && rs_bandwidth_size(index) < (size_t)state->bandwidth_knee_bytes[k]) {
+            ++index;
+        }
+        const float x = rs_bandwidth_plot_x(&bandwidth_area, index);
+        SDL_RenderDrawLineF(renderer, x, bandwidth_area.y, x, latency_area.y + latency_area.h);
+    }
+
+    if (metrics) {
+        metrics->draw_calls += 2 + RS_BANDWIDTH_SIZES + state->bandwidth_knee_count;
+    }
+}
+
+void rs_scene_bandwidth_cleanup(RenderSuiteState *state)
+{
+    (void)state;
+    rs_bandwidth_free();
+}
+
+void rs_scene_bandwidth(RenderSuiteState *state,
+                        SDL_Renderer *renderer,
+                        BenchMetrics *metrics,
+                        double delta_seconds)
+{
+    (void)delta_seconds;
+    if (!state || !renderer) {
+        return;
+    }
+
+    if (state->bandwidth_step == 0 || state->bandwidth_step < state->bandwidth_sizes * BANDWIDTH_STEPS_PER_SIZE) {
+        rs_bandwidth_step(state);
+    }
+
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+    rs_bandwidth_plot(state, renderer, metrics);
+}
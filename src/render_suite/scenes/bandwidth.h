@@ -0,0 +1,17 @@
+#ifndef RENDER_SUITE_SCENES_BANDWIDTH_H
+#define RENDER_SUITE_SCENES_BANDWIDTH_H
+
+#include <SDL2/SDL.h>
+
+#include "bench_common.h"
+#include "render_suite/state.h"
+
+void rs_scene_bandwidth(RenderSuiteState *state,
+                        SDL_Renderer *renderer,
+                        BenchMetrics *metrics,
+                        double delta_seconds);
+
+// Frees the probe buffer if a sweep was interrupted
+void rs_scene_bandwidth_cleanup(RenderSuiteState *state);
+
+#endif /* RENDER_SUITE_SCENES_BANDWIDTH_H */
@@ -0,0 +1,289 @@
+#include "render_suite/scenes/convert.h"
+
+#include <stdlib.h>
+
+#define CONVERT_WIDTH BENCH_SCREEN_W
+#define CONVERT_HEIGHT BENCH_SCREEN_H
+
+static const char *convert_path_names[RS_CONVERT_PATH_MAX] = {
+    "SDL_ConvertPixels",
+    "Direct Upload",
+    "Scalar",
+    "SIMD"
+};
+
+// Reports "NEON" on builds where the SIMD path really is NEON
+static const char *rs_convert_path_name(int path)
+{
+    return path == RS_CONVERT_PATH_SIMD ? rs_scaler_variant_name(RS_SCALER_SIMD) : convert_path_names[path];
+}
+
+/*
+ * One full-screen frame per source format, generated once so every path
+ * converts identical input. `converted` is sized for the widest format and
+ * holds the frame in the destination format. `target` holds a texture per
+ * destination format for the converting paths to upload into, and `direct`
+ * one per source format for the path that uploads the frame untouched.
+ */
+typedef struct {
+    void *source[RS_CONVERT_FORMAT_MAX];
+    int source_pitch[RS_CONVERT_FORMAT_MAX];
+    Uint32 *converted;
+    SDL_Texture *target[RS_CONVERT_FORMAT_MAX];
+    SDL_Texture *direct[RS_CONVERT_FORMAT_MAX];
+} ConvertBench;
+
+static ConvertBench g_convert_bench;
+
+static double rs_convert_elapsed_ms(Uint64 start, Uint64 end)
+{
+    return (double)(end - start) / (double)SDL_GetPerformanceFrequency() * 1000.0;
+}
+
+// Gradients plus a checker of transparent cells so ARGB1555's alpha bit varies
+static void rs_convert_fill_reference(Uint32 *pixels)
+{
+    for (int y = 0; y < CONVERT_HEIGHT; ++y) {
+        for (int x = 0; x < CONVERT_WIDTH; ++x) {
+            const Uint32 r = (Uint32)(x * 255 / (CONVERT_WIDTH - 1));
+            const Uint32 g = (Uint32)(y * 255 / (CONVERT_HEIGHT - 1));
+            const Uint32 b = (Uint32)((x ^ y) & 0xFF);
+            const Uint32 a = (((x >> 5) + (y >> 5)) & 1) ? 0xFFu : 0x00u;
+            pixels[(size_t)y * CONVERT_WIDTH + (size_t)x] = (r << 24) | (g << 16) | (b << 8) | a;
+        }
+    }
+}
+
+// One pixel of a converted frame; BGR888's padding byte is not compared
+static Uint32 rs_convert_check_pixel(const void *pixels, RSConvertFormat format, size_t index)
+{
+    if (rs_convert_bytes_per_pixel(format) == 2) {
+        return ((const Uint16 *)pixels)[index];
+    }
+    const Uint32 pixel = ((const Uint32 *)pixels)[index];
+    return (format == RS_CONVERT_BGR888) ? (pixel & 0x00FFFFFFu) : pixel;
+}
+
+/*
+ * Converts every source frame into every destination format through SDL,
+ * scalar and SIMD and counts pixels where any of them disagree. A non-zero
+ * count means the hand-written converters no longer match SDL's channel
+ * expansion or truncation.
+ */
+static int rs_convert_check(ConvertBench *bench)
+{
+    const size_t pixel_count = (size_t)CONVERT_WIDTH * CONVERT_HEIGHT;
+    Uint32 *scalar = malloc(sizeof(Uint32) * pixel_count);
+    Uint32 *simd = malloc(sizeof(Uint32) * pixel_count);
+    if (!scalar || !simd) {
+        free(scalar);
+        free(simd);
+        return -1;
+    }
+
+    int mismatches = 0;
+    for (int format = 0; format < RS_CONVERT_FORMAT_MAX; ++format) {
+        for (int dst_format = 0; dst_format < RS_CONVERT_FORMAT_MAX; ++dst_format) {
+            const int dst_pitch = CONVERT_WIDTH * rs_convert_bytes_per_pixel((RSConvertFormat)dst_format);
+            SDL_ConvertPixels(CONVERT_WIDTH, CONVERT_HEIGHT,
+                              rs_convert_sdl_format((RSConvertFormat)format),
+                              bench->source[format], bench->source_pitch[format],
+                              rs_convert_sdl_format((RSConvertFormat)dst_format),
+                              bench->converted, dst_pitch);
+            rs_convert_pixels((RSConvertFormat)format, bench->source[format], bench->source_pitch[format],
+                              (RSConvertFormat)dst_format, scalar, dst_pitch,
+                              CONVERT_WIDTH, CONVERT_HEIGHT, RS_SCALER_SCALAR);
+            rs_convert_pixels((RSConvertFormat)format, bench->source[format], bench->source_pitch[format],
+                              (RSConvertFormat)dst_format, simd, dst_pitch,
+                              CONVERT_WIDTH, CONVERT_HEIGHT, RS_SCALER_SIMD);
+
+            int pair_mismatches = 0;
+            for (size_t i = 0; i < pixel_count; ++i) {
+                const Uint32 expected = rs_convert_check_pixel(bench->converted, (RSConvertFormat)dst_format, i);
+                if (rs_convert_check_pixel(scalar, (RSConvertFormat)dst_format, i) != expected ||
+                    rs_convert_check_pixel(simd, (RSConvertFormat)dst_format, i) != expected) {
+                    ++pair_mismatches;
+                }
+            }
+            if (pair_mismatches) {
+                SDL_Log("Convert check %s -> %s: %d of %zu pixels differ between SDL, scalar and SIMD",
+                        rs_convert_format_name((RSConvertFormat)format),
+                        rs_convert_format_name((RSConvertFormat)dst_format),
+                        pair_mismatches, pixel_count);
+            }
+            mismatches += pair_mismatches;
+        }
+    }
+
+    free(scalar);
+    free(simd);
+    return mismatches;
+}
+
+// Streaming texture in the given format, created on first use
+static SDL_Texture *rs_convert_texture(SDL_Texture **slot, SDL_Renderer *renderer, int format)
+{
+    if (!*slot) {
+        *slot = SDL_CreateTexture(renderer,
+                                  rs_convert_sdl_format((RSConvertFormat)format),
+                                  SDL_TEXTUREACCESS_STREAMING,
+                                  CONVERT_WIDTH,
+                                  CONVERT_HEIGHT);
+        if (*slot) {
+            SDL_SetTextureBlendMode(*slot, SDL_BLENDMODE_NONE);
+        }
+    }
+    return *slot;
+}
+
+void rs_scene_convert_init(RenderSuiteState *state, SDL_Renderer *renderer)
+{
+    if (!state) return;
+
+    ConvertBench *bench = &g_convert_bench;
+    SDL_memset(bench, 0, sizeof(*bench));
+
+    const size_t pixel_count = (size_t)CONVERT_WIDTH * CONVERT_HEIGHT;
+    bench->converted = malloc(sizeof(Uint32) * pixel_count);
+    if (!bench->converted) {
+        return;
+    }
+    rs_convert_fill_reference(bench->converted);
+
+    for (int format = 0; format < RS_CONVERT_FORMAT_MAX; ++format) {
+        const Uint32 sdl_format = rs_convert_sdl_format((RSConvertFormat)format);
+        bench->source_pitch[format] = CONVERT_WIDTH * SDL_BYTESPERPIXEL(sdl_format);
+        bench->source[format] = malloc((size_t)bench->source_pitch[format] * CONVERT_HEIGHT);
+        if (!bench->source[format]) {
+            rs_scene_convert_cleanup(state);
+            return;
+        }
+        SDL_ConvertPixels(CONVERT_WIDTH, CONVERT_HEIGHT,
+                          SDL_PIXELFORMAT_RGBA8888, bench->converted, CONVERT_WIDTH * (int)sizeof(Uint32),
+                          sdl_format, bench->source[format], bench->source_pitch[format]);
+    }
+
+    state->convert_check_mismatches = rs_convert_check(bench);
+
+    if (renderer) {
+        rs_convert_texture(&bench->target[RS_CONVERT_RGBA8888], renderer, RS_CONVERT_RGBA8888);
+    }
+}
+
+void rs_scene_convert_report(const RenderSuiteState *state)
+{
+    if (!state) return;
+
+    if (state->convert_check_mismatches != 0) {
+        SDL_Log("Convert self-check: %d mismatching pixels", state->convert_check_mismatches);
+    }
+    for (int format = 0; format < RS_CONVERT_FORMAT_MAX; ++format) {
+        for (int dst_format = 0; dst_format < RS_CONVERT_FORMAT_MAX; ++dst_format) {
+            for (int path = 0; path < RS_CONVERT_PATH_MAX; ++path) {
+                const Uint64 runs = state->convert_runs[format][dst_format][path];
+                if (runs == 0) {
+                    continue;
+                }
+                const double cpu_ms = state->convert_cpu_ms[format][dst_format][path] / (double)runs;
+                const double upload_ms = state->convert_upload_ms[format][dst_format][path] / (double)runs;
+                const double total_ms = cpu_ms + upload_ms;
+                SDL_Log("Convert %-8s -> %-8s %-17s: convert %.3fms | upload %.3fms | %.1f MP/s (%llu)",
+                        rs_convert_format_name((RSConvertFormat)format),
+                        rs_convert_format_name((RSConvertFormat)dst_format),
+                        rs_convert_path_name(path),
+                        cpu_ms,
+                        upload_ms,
+                        total_ms > 0.0 ? (double)CONVERT_WIDTH * CONVERT_HEIGHT / (total_ms * 1000.0) : 0.0,
+                        (unsigned long long)runs);
+            }
+        }
+    }
+}
+
+void rs_scene_convert_cleanup(RenderSuiteState *state)
+{
+    ConvertBench *bench = &g_convert_bench;
+    (void)state;
+
+    for (int format = 0; format < RS_CONVERT_FORMAT_MAX; ++format) {
+        free(bench->source[format]);
+        if (bench->direct[format]) {
+            SDL_DestroyTexture(bench->direct[format]);
+        }
+        if (bench->target[format]) {
+            SDL_DestroyTexture(bench->target[format]);
+        }
+    }
+    free(bench->converted);
+    SDL_memset(bench, 0, sizeof(*bench));
+}
+
+void rs_scene_convert(RenderSuiteState *state,
+                      SDL_Renderer *renderer,
+                      BenchMetrics *metrics,
+                      double delta_seconds)
+{
+    ConvertBench *bench = &g_convert_bench;
+    (void)delta_seconds;
+
+    if (!state || !renderer || !bench->converted) {
+        return;
+    }
+
+    const int format = SDL_clamp(state->convert_format, 0, RS_CONVERT_FORMAT_MAX - 1);
+    const int dst_format = SDL_clamp(state->convert_dst_format, 0, RS_CONVERT_FORMAT_MAX - 1);
+    const int path = SDL_clamp(state->convert_path, 0, RS_CONVERT_PATH_MAX - 1);
+    const void *source = bench->source[format];
+    const int source_pitch = bench->source_pitch[format];
+    const int converted_pitch = CONVERT_WIDTH * rs_convert_bytes_per_pixel((RSConvertFormat)dst_format);
+    SDL_Texture *texture = (path == RS_CONVERT_PATH_UPLOAD) ?
+        rs_convert_texture(&bench->direct[format], renderer, format) :
+        rs_convert_texture(&bench->target[dst_format], renderer, dst_format);
+    if (!texture) {
+        return;
+    }
+
+    const Uint64 convert_start = SDL_GetPerformanceCounter();
+    switch (path) {
+        case RS_CONVERT_PATH_SDL:
+            SDL_ConvertPixels(CONVERT_WIDTH, CONVERT_HEIGHT,
+                              rs_convert_sdl_format((RSConvertFormat)format), source, source_pitch,
+                              rs_convert_sdl_format((RSConvertFormat)dst_format),
+                              bench->converted, converted_pitch);
+            break;
+        case RS_CONVERT_PATH_SCALAR:
+        case RS_CONVERT_PATH_SIMD:
+            rs_convert_pixels((RSConvertFormat)format, source, source_pitch,
+                              (RSConvertFormat)dst_format, bench->converted, converted_pitch,
+                              CONVERT_WIDTH, CONVERT_HEIGHT,
+                              path == RS_CONVERT_PATH_SIMD ? RS_SCALER_SIMD : RS_SCALER_SCALAR);
+            break;
+        default:
+            break;
+    }
+    const Uint64 upload_start = SDL_GetPerformanceCounter();
+
+    if (path == RS_CONVERT_PATH_UPLOAD) {
+        SDL_UpdateTexture(texture, NULL, source, source_pitch);
+    } else {
+        SDL_UpdateTexture(texture, NULL, bench->converted, converted_pitch);
+    }
+    const Uint64 upload_end = SDL_GetPerformanceCounter();
+
+    const double upload_ms = rs_convert_elapsed_ms(upload_start, upload_end);
+    state->convert_cpu_ms[format][dst_format][path] += rs_convert_elapsed_ms(convert_start, upload_start);
+    state->convert_upload_ms[format][dst_format][path] += upload_ms;
+    state->convert_runs[format][dst_format][path]++;
+
+    const int region_height = SDL_max(1, BENCH_SCREEN_H - (int)state->top_margin);
+    const SDL_Rect dest = {0, (int)state->top_margin, BENCH_SCREEN_W, region_height};
+    SDL_RenderCopy(renderer, texture, NULL, &dest);
+
+    if (metrics) {
+        metrics->pixel_operations += (Uint64)CONVERT_WIDTH * CONVERT_HEIGHT;
+        metrics->lock_unlock_overhead_ms += upload_ms;
+        metrics->draw_calls++;
+        metrics->vertices_rendered += 4;
+        metrics->triangles_rendered += 2;
+    }
+}
@@ -0,0 +1,18 @@
+#ifndef RENDER_SUITE_SCENES_CONVERT_H
+#define RENDER_SUITE_SCENES_CONVERT_H
+
+#include <SDL2/SDL.h>
+
+#include "bench_common.h"
+#include "render_suite/state.h"
+
+void rs_scene_convert(RenderSuiteState *state,
+                      SDL_Renderer *renderer,
+                      BenchMetrics *metrics,
+                      double delta_seconds);
+
+void rs_scene_convert_init(RenderSuiteState *state, SDL_Renderer *renderer);
+void rs_scene_convert_cleanup(RenderSuiteState *state);
+void rs_scene_convert_report(const RenderSuiteState *state);
+
+#endif /* RENDER_SUITE_SCENES_CONVERT_H */
@@ -1,4 +1,7 @@
 #include "render_suite/scenes/fill.h"
+#include "render_suite/vertex_batch.h"
+
+static RSVertexBatch g_fill_batch;
 
 static float rs_clamp01(float value)
 {
@@ -54,6 +57,9 @@ void rs_scene_fill(RenderSuiteState *state,
     }
 
     const float column_stride = table_size / (float)columns;
+    const int path = state->fill_batched ? 1 : 0;
+    RSVertexBatch *batch = state->fill_batched ? &g_fill_batch : NULL;
+    const Uint64 submit_start = SDL_GetPerformanceCounter();
 
     for (int pass = 0; pass < passes; ++pass) {
         const float pass_phase = state->fill_phase_units + (float)(pass * 37);
@@ -72,11 +78,21 @@ void rs_scene_fill(RenderSuiteState *state,
             const float g_mix = rs_clamp01(0.25f + (1.0f - sweep) * 0.45f + shimmer * 0.20f);
             const float b_mix = rs_clamp01(0.38f + sweep * 0.30f + (1.0f - shimmer) * 0.25f);
 
-            SDL_SetRenderDrawColor(renderer,
-                                   rs_float_to_u8(r_mix),
-                                   rs_float_to_u8(g_mix),
-                                   rs_float_to_u8(b_mix),
-                                   255);
+            const SDL_Color colour = {rs_float_to_u8(r_mix), rs_float_to_u8(g_mix), rs_float_to_u8(b_mix), 255};
+
+            if (batch) {
+                // Same rect as two triangles; counted when the batch is flushed
+                const float x0 = (float)col_x;
+                const float x1 = (float)(col_x + col_w);
+                const float y0 = (float)start_y;
+                const float y1 = (float)(start_y + region_height);
+                const SDL_FPoint corners[4] = {{x0, y0}, {x1, y0}, {x1, y1}, {x0, y1}};
+                const SDL_Color colours[4] = {colour, colour, colour, colour};
+                rs_vertex_batch_add_quad(batch, corners, colours);
+                continue;
+            }
+
+            SDL_SetRenderDrawColor(renderer, colour.r, colour.g, colour.b, colour.a);
 
             SDL_Rect rect = {col_x, start_y, col_w, region_height};
             SDL_RenderFillRect(renderer, &rect);
@@ -87,4 +103,30 @@ void rs_scene_fill(RenderSuiteState *state,
             }
         }
     }
+
+    // Passes overdraw each other in order, so one submission keeps the result
+    if (batch) {
+        rs_vertex_batch_flush(batch, renderer, NULL, metrics);
+    }
+
+    state->fill_submit_ms[path] += (double)(SDL_GetPerformanceCounter() - submit_start) /
+                                   (double)SDL_GetPerformanceFrequency() * 1000.0;
+    state->fill_submit_runs[path]++;
+}
+
+void rs_scene_fill_report(const RenderSuiteState *state)
+{
+    if (state && (state->fill_submit_runs[0] || state->fill_submit_runs[1])) {
+        SDL_Log("Fill submit: per-rect %.3fms (%llu) | batched %.3fms (%llu)",
+                state->fill_submit_runs[0] ? state->fill_submit_ms[0] / (double)state->fill_submit_runs[0] : 0.0,
+                (unsigned long long)state->fill_submit_runs[0],
+                state->fill_submit_runs[1] ? state->fill_submit_ms[1] / (double)state->fill_submit_runs[1] : 0.0,
+                (unsigned long long)state->fill_submit_runs[1]);
+    }
+}
+
+void rs_scene_fill_cleanup(RenderSuiteState *state)
+{
+    (void)state;
+    rs_vertex_batch_free(&g_fill_batch);
 }
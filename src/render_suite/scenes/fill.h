@@ -8,4 +8,9 @@ void rs_scene_fill(RenderSuiteState *state,
                    BenchMetrics *metrics,
                    double delta_seconds);
 
+void rs_scene_fill_cleanup(RenderSuiteState *state);
+
+// Logs per-rect vs batched submit times
+void rs_scene_fill_report(const RenderSuiteState *state);
+
 #endif /* RENDER_SUITE_SCENES_FILL_H */
@@ -1,9 +1,45 @@
 #include <math.h>
 
 #include "render_suite/scenes/lines.h"
+#include "render_suite/vertex_batch.h"
 
 #define RS_PI 3.14159265358979323846f
 
+// Quad width and edge feather per batched mode, in pixels
+static const float lines_mode_width[RS_LINES_MODE_MAX] = {1.0f, 1.0f, 2.0f};
+static const float lines_mode_feather[RS_LINES_MODE_MAX] = {0.0f, 0.0f, 1.0f};
+
+static const char *lines_mode_names[RS_LINES_MODE_MAX] = {
+    "Per-line",
+    "Batched",
+    "Batched AA"
+};
+
+static RSVertexBatch g_line_batch;
+
+/*
+ * Emits one line either straight to the renderer or into the batch. The
+ * per-line path is the original one: a colour change plus a draw call for
+ * every segment.
+ */
+static void rs_emit_line(SDL_Renderer *renderer,
+                         RSVertexBatch *batch,
+                         int mode,
+                         float x0,
+                         float y0,
+                         float x1,
+                         float y1,
+                         SDL_Color colour)
+{
+    if (!batch) {
+        SDL_SetRenderDrawColor(renderer, colour.r, colour.g, colour.b, colour.a);
+        SDL_RenderDrawLineF(renderer, x0, y0, x1, y1);
+        return;
+    }
+    rs_vertex_batch_add_line(batch, x0, y0, x1, y1,
+                             lines_mode_width[mode], lines_mode_feather[mode], colour);
+}
+
 static inline float rs_clampf(float value, float min_val, float max_val)
 {
     if (value < min_val) {
@@ -47,6 +83,7 @@ static Uint8 rs_color_component(const RenderSuiteState *state, float n)
 
 static void rs_draw_radial_fan(const RenderSuiteState *state,
                                SDL_Renderer *renderer,
+                               RSVertexBatch *batch,
                                float center_x,
                                float center_y,
                                float radius_min,
@@ -70,12 +107,13 @@ static void rs_draw_radial_fan(const RenderSuiteState *state,
         const Uint8 g = rs_color_component(state, hue + RS_PI * 0.66f);
         const Uint8 b = rs_color_component(state, hue + RS_PI * 1.33f);
 
-        SDL_SetRenderDrawColor(renderer, r, g, b, 220);
-        SDL_RenderDrawLineF(renderer, center_x, center_y, x1, y1);
+        const SDL_Color colour = {r, g, b, 220};
+        rs_emit_line(renderer, batch, state->lines_mode, center_x, center_y, x1, y1, colour);
         ++lines_drawn;
     }
 
-    if (metrics) {
+    // Batched lines are counted when the batch is flushed
+    if (metrics && !batch) {
         metrics->draw_calls += lines_drawn;
         metrics->vertices_rendered += lines_drawn * 2;
     }
@@ -83,6 +121,7 @@ static void rs_draw_radial_fan(const RenderSuiteState *state,
 
 static void rs_draw_sweeps(const RenderSuiteState *state,
                            SDL_Renderer *renderer,
+                           RSVertexBatch *batch,
                            int start_x,
                            int start_y,
                            int length,
@@ -108,30 +147,36 @@ static void rs_draw_sweeps(const RenderSuiteState *state,
         Uint8 g = (Uint8)rs_clampi((int)base_g + (int)(oscillate * 40.0f), 0, 255);
         Uint8 b = (Uint8)rs_clampi((int)base_b + (int)(oscillate * 40.0f), 0, 255);
 
-        SDL_SetRenderDrawColor(renderer, r, g, b, 200);
+        const SDL_Color colour = {r, g, b, 200};
 
         if (horizontal) {
             const float base_y = (float)start_y + t * (float)length;
             const float offset = oscillate * amplitude;
-            SDL_RenderDrawLineF(renderer,
-                                0.0f - amplitude,
-                                base_y + offset,
-                                (float)BENCH_SCREEN_W + amplitude,
-                                base_y - offset);
+            rs_emit_line(renderer,
+                         batch,
+                         state->lines_mode,
+                         0.0f - amplitude,
+                         base_y + offset,
+                         (float)BENCH_SCREEN_W + amplitude,
+                         base_y - offset,
+                         colour);
         } else {
             const float base_x = (float)start_x + t * (float)length;
             const float offset = oscillate * amplitude;
-            SDL_RenderDrawLineF(renderer,
-                                base_x + offset,
-                                (float)start_y,
-                                base_x - offset,
-                                (float)start_y + (float)length);
+            rs_emit_line(renderer,
+                         batch,
+                         state->lines_mode,
+                         base_x + offset,
+                         (float)start_y,
+                         base_x - offset,
+                         (float)start_y + (float)length,
+                         colour);
         }
 
         ++lines_drawn;
     }
 
-    if (metrics) {
+    if (metrics && !batch) {
         metrics->draw_calls += lines_drawn;
         metrics->vertices_rendered += lines_drawn * 2;
     }
@@ -163,18 +208,25 @@ void rs_scene_lines(RenderSuiteState *state,
 
     const float phase = (float)state->lines_cursor_index * 0.175f + state->lines_cursor_progress * 0.175f;
 
+    const int mode = SDL_clamp(state->lines_mode, 0, RS_LINES_MODE_MAX - 1);
+    RSVertexBatch *batch = (mode == RS_LINES_MODE_PER_LINE) ? NULL : &g_line_batch;
+    const Uint64 submit_start = SDL_GetPerformanceCounter();
+
+    // Every line shares the additive blend, so the batch is flushed once.
+    // RenderGeometry takes its blend from the draw blend mode when untextured.
     SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_ADD);
 
     /* radial burst */
     const int radial_segments = rs_clampi((int)(stress_scale * 96.0f), 32, 240);
     const float radius_min = (float)SDL_min(BENCH_SCREEN_W, region_height) * 0.18f;
     const float radius_max = (float)SDL_min(BENCH_SCREEN_W, region_height) * (0.25f + stress_scale * 0.12f);
-    rs_draw_radial_fan(state, renderer, center_x, center_y, radius_min, radius_max, phase, radial_segments, metrics);
+    rs_draw_radial_fan(state, renderer, batch, center_x, center_y, radius_min, radius_max, phase, radial_segments, metrics);
 
     /* horizontal sweeps */
     const int horizontal_rows = rs_clampi((int)(stress_scale * 40.0f), 12, 160);
     rs_draw_sweeps(state,
                    renderer,
+                   batch,
                    0,
                    (int)state->top_margin,
                    region_height,
@@ -191,6 +243,7 @@ void rs_scene_lines(RenderSuiteState *state,
     const int vertical_rows = rs_clampi((int)(stress_scale * 36.0f), 10, 140);
     rs_draw_sweeps(state,
                    renderer,
+                   batch,
                    0,
                    (int)state->top_margin,
                    region_height,
@@ -203,5 +256,43 @@ void rs_scene_lines(RenderSuiteState *state,
                    200,
                    metrics);
 
+    if (batch) {
+        rs_vertex_batch_flush(batch, renderer, NULL, metrics);
+    }
+
+    const int level = SDL_clamp(state->stress_level, 1, RS_STRESS_LEVEL_MAX) - 1;
+    state->lines_submit_ms[mode][level] += (double)(SDL_GetPerformanceCounter() - submit_start) /
+                                           (double)SDL_GetPerformanceFrequency() * 1000.0;
+    state->lines_submit_runs[mode][level]++;
+
     SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
 }
+
+void rs_scene_lines_report(const RenderSuiteState *state)
+{
+    if (!state) return;
+
+    for (int level = 0; level < RS_STRESS_LEVEL_MAX; ++level) {
+        char line[160];
+        int length = SDL_snprintf(line, sizeof(line), "Lines stress %2d:", level + 1);
+        SDL_bool any = SDL_FALSE;
+        for (int mode = 0; mode < RS_LINES_MODE_MAX && length < (int)sizeof(line); ++mode) {
+            const Uint64 runs = state->lines_submit_runs[mode][level];
+            any = any || runs;
+            length += SDL_snprintf(line + length, sizeof(line) - (size_t)length,
+                                   " | %s %.3fms (%llu)",
+                                   lines_mode_names[mode],
+                                   runs ? state->lines_submit_ms[mode][level] / (double)runs : 0.0,
+                                   (unsigned long long)runs);
+        }
+        if (any) {
+            SDL_Log("%s", line);
+        }
+    }
+}
+
+void rs_scene_lines_cleanup(RenderSuiteState *state)
+{
+    (void)state;
+    rs_vertex_batch_free(&g_line_batch);
+}
@@ -6,6 +6,11 @@
 void rs_scene_lines(RenderSuiteState *state,
                     SDL_Renderer *renderer,
                     BenchMetrics *metrics,
-                    double time_seconds);
+                    double delta_seconds);
+
+void rs_scene_lines_cleanup(RenderSuiteState *state);
+
+// Logs per-mode submit times for each stress level
+void rs_scene_lines_report(const RenderSuiteState *state);
 
 #endif /* RENDER_SUITE_SCENES_LINES_H */
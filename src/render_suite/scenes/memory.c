@@ -1,5 +1,9 @@
 #include "render_suite/scenes/memory.h"
 #include "render_suite/render_neon.h"
+#include "render_suite/texture_pool.h"
+
+#include <SDL2/SDL_mutex.h>
+#include <SDL2/SDL_thread.h>
 
 #include <stdlib.h>
 #include <math.h>
@@ -9,11 +13,16 @@
 #define TEXTURE_POOL_SIZE 20
 #define MIN_TEXTURE_SIZE 16
 #define MAX_TEXTURE_SIZE 128
+#define MEMORY_POOL_BUDGET (4u * 1024u * 1024u) // Idle textures kept beyond this get evicted
+#define STAGING_SLOTS 8 // Bounded request slots shared by creations and streaming updates
+#define STAGING_CREATE_AHEAD 4 // Creation orders kept queued while async content is on
+#define STAGING_EDGE MAX_TEXTURE_SIZE // Slot capacity; items are generated at the requested size
 
 typedef struct {
     SDL_Texture *texture;
     Uint32 *pixel_cache;
     size_t pixel_capacity;
+    RSPooledTexture *pooled;  // Owning pool entry in pooled mode, NULL when churning
     int width;
     int height;
     Uint32 format;
@@ -32,10 +41,66 @@ typedef struct {
     double total_allocation_time_ms;
     int allocation_count;
     int deallocation_count;
+
+    int mode;
+    RSTexturePool pool;
+    double alloc_ms[RS_MEMORY_MODE_MAX];
+    Uint64 alloc_count[RS_MEMORY_MODE_MAX];
+    Uint64 content_misses;
+    double frame_upload_ms;
+    Uint64 pool_hits_folded;     // Pool counters already added to RenderSuiteState
+    Uint64 pool_misses_folded;
+    Uint64 pool_evictions_folded;
 } ResourceManager;
 
 static ResourceManager g_resource_manager = {0};
 
+typedef enum {
+    STAGING_FREE = 0,
+    STAGING_QUEUED,    // Ordered by the render thread, waiting for the producer
+    STAGING_BUSY,      // Being filled outside the lock
+    STAGING_READY
+} StagingStatus;
+
+// One content order: what to generate, and the buffer it is generated into
+typedef struct {
+    Uint32 *pixels;            // STAGING_EDGE^2 capacity, packed at width
+    StagingStatus status;
+    SDL_bool cancelled;        // Resource went away while the item was being filled
+    Uint32 ticket;             // Order of the request; the oldest is filled first
+    int target;                // Resource index for a streaming update, -1 for a creation
+    int width;
+    int height;
+    int pattern;
+    float phase;
+} StagingSlot;
+
+/*
+ * Request slots between the render thread and one producer thread. The
+ * render thread orders content ahead of need: the resources it will stream
+ * next frame at their own size and pattern, plus a few creation orders
+ * whose size it picks up front. The producer fills the oldest order outside
+ * the lock. The render thread only copies READY items and frees the slot
+ * afterwards, so an item is never written while it is being copied.
+ */
+typedef struct {
+    SDL_mutex *mutex;
+    SDL_cond *work_cond;
+    SDL_Thread *thread;
+    SDL_bool running;
+
+    StagingSlot slots[STAGING_SLOTS];
+    Uint32 next_ticket;
+
+    Uint64 start_counter;
+    Uint64 busy_counter;       // Performance-counter ticks spent generating
+    Uint64 busy_since;         // Start of the item in progress, 0 while idle
+    double depth_sum;
+    Uint64 depth_samples;
+} ContentProducer;
+
+static ContentProducer g_content_producer = {0};
+
 static inline float rs_clampf(float value, float min_val, float max_val)
 {
     if (value < min_val) return min_val;
@@ -128,68 +193,392 @@ static void rs_generate_texture_data(Uint32 *pixels, int width, int height, floa
     }
 }
 
+static int rs_content_producer_thread(void *userdata)
+{
+    ContentProducer *producer = (ContentProducer *)userdata;
+
+    SDL_LockMutex(producer->mutex);
+    while (producer->running) {
+        StagingSlot *item = NULL;
+        for (int i = 0; i < STAGING_SLOTS; i++) {
+            StagingSlot *slot = &producer->slots[i];
+            if (slot->status == STAGING_QUEUED &&
+                (!item || (Sint32)(slot->ticket - item->ticket) < 0)) {
+                item = slot;
+            }
+        }
+        if (!item) {
+            SDL_CondWait(producer->work_cond, producer->mutex);
+            continue;
+        }
+
+        item->status = STAGING_BUSY;
+        const int width = item->width;
+        const int height = item->height;
+        const int pattern = item->pattern;
+        const float phase = item->phase;
+        producer->busy_since = SDL_GetPerformanceCounter();
+        SDL_UnlockMutex(producer->mutex);
+
+        rs_generate_texture_data(item->pixels, width, height, phase, pattern);
+
+        SDL_LockMutex(producer->mutex);
+        producer->busy_counter += SDL_GetPerformanceCounter() - producer->busy_since;
+        producer->busy_since = 0;
+        item->status = item->cancelled ? STAGING_FREE : STAGING_READY;
+        item->cancelled = SDL_FALSE;
+    }
+    SDL_UnlockMutex(producer->mutex);
+    return 0;
+}
+
+static void rs_content_producer_stop(void)
+{
+    ContentProducer *producer = &g_content_producer;
+    if (producer->thread) {
+        SDL_LockMutex(producer->mutex);
+        producer->running = SDL_FALSE;
+        SDL_CondSignal(producer->work_cond);
+        SDL_UnlockMutex(producer->mutex);
+        SDL_WaitThread(producer->thread, NULL);
+    }
+    if (producer->work_cond) {
+        SDL_DestroyCond(producer->work_cond);
+    }
+    if (producer->mutex) {
+        SDL_DestroyMutex(producer->mutex);
+    }
+    for (int i = 0; i < STAGING_SLOTS; i++) {
+        free(producer->slots[i].pixels);
+    }
+    SDL_memset(producer, 0, sizeof(*producer));
+}
+
+static SDL_bool rs_content_producer_start(void)
+{
+    ContentProducer *producer = &g_content_producer;
+    rs_content_producer_stop();
+
+    for (int i = 0; i < STAGING_SLOTS; i++) {
+        producer->slots[i].pixels = malloc(sizeof(Uint32) * STAGING_EDGE * STAGING_EDGE);
+        if (!producer->slots[i].pixels) {
+            rs_content_producer_stop();
+            return SDL_FALSE;
+        }
+    }
+
+    producer->mutex = SDL_CreateMutex();
+    producer->work_cond = SDL_CreateCond();
+    if (!producer->mutex || !producer->work_cond) {
+        rs_content_producer_stop();
+        return SDL_FALSE;
+    }
+
+    producer->running = SDL_TRUE;
+    producer->start_counter = SDL_GetPerformanceCounter();
+    producer->thread = SDL_CreateThread(rs_content_producer_thread, "rs_content", producer);
+    if (!producer->thread) {
+        rs_content_producer_stop();
+        return SDL_FALSE;
+    }
+    return SDL_TRUE;
+}
+
+// Queues an order unless the target already has one or every slot is taken
+static void rs_content_request(int target, int width, int height, int pattern, float phase)
+{
+    ContentProducer *producer = &g_content_producer;
+    if (!producer->thread) {
+        return;
+    }
+
+    SDL_LockMutex(producer->mutex);
+    StagingSlot *free_slot = NULL;
+    for (int i = 0; i < STAGING_SLOTS; i++) {
+        StagingSlot *slot = &producer->slots[i];
+        if (slot->status == STAGING_FREE) {
+            if (!free_slot) {
+                free_slot = slot;
+            }
+        } else if (target >= 0 && slot->target == target && !slot->cancelled) {
+            SDL_UnlockMutex(producer->mutex);
+            return;
+        }
+    }
+    if (free_slot) {
+        free_slot->status = STAGING_QUEUED;
+        free_slot->cancelled = SDL_FALSE;
+        free_slot->ticket = producer->next_ticket++;
+        free_slot->target = target;
+        free_slot->width = rs_clampi(width, 1, STAGING_EDGE);
+        free_slot->height = rs_clampi(height, 1, STAGING_EDGE);
+        free_slot->pattern = pattern;
+        free_slot->phase = phase;
+        SDL_CondSignal(producer->work_cond);
+    }
+    SDL_UnlockMutex(producer->mutex);
+}
+
+static int rs_content_creation_orders(void)
+{
+    ContentProducer *producer = &g_content_producer;
+    int orders = 0;
+    SDL_LockMutex(producer->mutex);
+    for (int i = 0; i < STAGING_SLOTS; i++) {
+        const StagingSlot *slot = &producer->slots[i];
+        if (slot->status != STAGING_FREE && slot->target < 0) {
+            orders++;
+        }
+    }
+    SDL_UnlockMutex(producer->mutex);
+    return orders;
+}
+
+/*
+ * The ready item for `target`, or NULL when it has not been produced yet.
+ * Creations take the oldest creation order and leave a late one queued for
+ * the next creation; an update that is not ready is cancelled, because the
+ * resource will not be streamed again until the rotation comes back round.
+ */
+static StagingSlot *rs_content_claim(int target)
+{
+    ContentProducer *producer = &g_content_producer;
+    if (!producer->thread) {
+        return NULL;
+    }
+
+    SDL_LockMutex(producer->mutex);
+    StagingSlot *item = NULL;
+    for (int i = 0; i < STAGING_SLOTS; i++) {
+        StagingSlot *slot = &producer->slots[i];
+        if (slot->status != STAGING_FREE && !slot->cancelled && slot->target == target &&
+            (!item || (Sint32)(slot->ticket - item->ticket) < 0)) {
+            item = slot;
+        }
+    }
+    if (item && item->status != STAGING_READY) {
+        if (target >= 0) {
+            if (item->status == STAGING_BUSY) {
+                item->cancelled = SDL_TRUE;
+            } else {
+                item->status = STAGING_FREE;
+            }
+        }
+        item = NULL;
+    }
+    SDL_UnlockMutex(producer->mutex);
+    return item;
+}
+
+static void rs_content_release(StagingSlot *item)
+{
+    ContentProducer *producer = &g_content_producer;
+    SDL_LockMutex(producer->mutex);
+    item->status = STAGING_FREE;
+    SDL_UnlockMutex(producer->mutex);
+}
+
+// Drops the orders of a resource that is going away
+static void rs_content_cancel(int target)
+{
+    ContentProducer *producer = &g_content_producer;
+    if (!producer->thread) {
+        return;
+    }
+
+    SDL_LockMutex(producer->mutex);
+    for (int i = 0; i < STAGING_SLOTS; i++) {
+        StagingSlot *slot = &producer->slots[i];
+        if (slot->status == STAGING_FREE || slot->target != target) {
+            continue;
+        }
+        if (slot->status == STAGING_BUSY) {
+            slot->cancelled = SDL_TRUE;
+        } else {
+            slot->status = STAGING_FREE;
+        }
+    }
+    SDL_UnlockMutex(producer->mutex);
+}
+
+static void rs_content_producer_stats(RenderSuiteState *state)
+{
+    ContentProducer *producer = &g_content_producer;
+    if (!producer->thread) {
+        state->memory_queue_depth = 0.0;
+        state->memory_producer_busy = 0.0;
+        return;
+    }
+
+    SDL_LockMutex(producer->mutex);
+    int ready = 0;
+    for (int i = 0; i < STAGING_SLOTS; i++) {
+        ready += (producer->slots[i].status == STAGING_READY) ? 1 : 0;
+    }
+    producer->depth_sum += ready;
+    producer->depth_samples++;
+
+    const Uint64 now = SDL_GetPerformanceCounter();
+    const Uint64 elapsed = now - producer->start_counter;
+    const Uint64 busy = producer->busy_counter + (producer->busy_since ? now - producer->busy_since : 0);
+    state->memory_queue_depth = producer->depth_sum / (double)producer->depth_samples;
+    state->memory_producer_busy = elapsed ? (double)busy / (double)elapsed : 0.0;
+    SDL_UnlockMutex(producer->mutex);
+}
+
+// Copies the staging rows into the texture. Pooled textures are larger than
+// the resource, so only the top-left region is locked and the pitch honoured.
+static SDL_bool rs_upload_pixels(ResourceTexture *res, const Uint32 *source, int source_stride)
+{
+    const SDL_Rect region = {0, 0, res->width, res->height};
+    void *texture_pixels;
+    int pitch;
+    if (SDL_LockTexture(res->texture, &region, &texture_pixels, &pitch) != 0) {
+        return SDL_FALSE;
+    }
+
+    for (int y = 0; y < res->height; y++) {
+        rs_neon_copy_u32((uint32_t *)((Uint8 *)texture_pixels + (size_t)y * (size_t)pitch),
+                         source + (size_t)y * (size_t)source_stride,
+                         (size_t)res->width);
+    }
+    SDL_UnlockTexture(res->texture);
+    return SDL_TRUE;
+}
+
+static SDL_bool rs_upload_resource(ResourceTexture *res)
+{
+    return rs_upload_pixels(res, res->pixel_cache, res->width);
+}
+
+// Uploads the item produced to order for this resource. Without one the
+// content is generated on the render thread, which counts as a miss while
+// async content is on. Lock + copy time goes to frame_upload_ms.
+static SDL_bool rs_fill_resource(ResourceTexture *res, StagingSlot *item, float phase, int pattern)
+{
+    if (!item) {
+        if (g_content_producer.thread) {
+            g_resource_manager.content_misses++;
+        }
+        rs_generate_texture_data(res->pixel_cache, res->width, res->height, phase, pattern);
+    }
+
+    const Uint64 start = SDL_GetPerformanceCounter();
+    SDL_bool uploaded;
+    if (item) {
+        uploaded = rs_upload_pixels(res, item->pixels, item->width);
+        rs_content_release(item);
+    } else {
+        uploaded = rs_upload_resource(res);
+    }
+    const double upload_ms = (double)(SDL_GetPerformanceCounter() - start) /
+                             (double)SDL_GetPerformanceFrequency() * 1000.0;
+    g_resource_manager.frame_upload_ms += upload_ms;
+    return uploaded;
+}
+
+static void rs_memory_track_bytes(BenchMetrics *metrics, Uint64 before, Uint64 after)
+{
+    if (after >= before) {
+        metrics->memory_allocated_bytes += after - before;
+        if (metrics->memory_allocated_bytes > metrics->memory_peak_bytes) {
+            metrics->memory_peak_bytes = metrics->memory_allocated_bytes;
+        }
+    } else {
+        const Uint64 freed = before - after;
+        metrics->memory_allocated_bytes -= SDL_min(freed, metrics->memory_allocated_bytes);
+    }
+}
+
 static SDL_bool rs_create_dynamic_texture(ResourceTexture *res,
                                           SDL_Renderer *renderer,
                                           int width,
                                           int height,
                                           float phase,
                                           int pattern,
+                                          StagingSlot *item,
                                           BenchMetrics *metrics)
 {
+    ResourceManager *manager = &g_resource_manager;
     Uint64 start_time = SDL_GetPerformanceCounter();
+    const size_t pixel_count = (size_t)width * (size_t)height;
+    Uint64 texture_bytes = 0;
+    SDL_bool allocated = SDL_TRUE;
+
+    if (manager->mode == RS_MEMORY_MODE_POOLED) {
+        const Uint64 resident_before = manager->pool.resident_bytes;
+        const Uint64 misses_before = manager->pool.misses;
+        res->pooled = rs_texture_pool_acquire(&manager->pool, SDL_PIXELFORMAT_RGBA8888, width, height);
+        if (!res->pooled) {
+            if (item) {
+                rs_content_release(item);
+            }
+            return SDL_FALSE;
+        }
+        res->texture = res->pooled->texture;
+        res->pixel_cache = res->pooled->pixels;
+        allocated = (manager->pool.misses != misses_before) ? SDL_TRUE : SDL_FALSE;
+        if (metrics) {
+            rs_memory_track_bytes(metrics, resident_before, manager->pool.resident_bytes);
+        }
+        manager->total_allocated_bytes = manager->pool.resident_bytes;
+    } else {
+        res->texture = SDL_CreateTexture(renderer,
+                                         SDL_PIXELFORMAT_RGBA8888,
+                                         SDL_TEXTUREACCESS_STREAMING,
+                                         width,
+                                         height);
+        if (!res->texture) {
+            if (item) {
+                rs_content_release(item);
+            }
+            return SDL_FALSE;
+        }
 
-    res->texture = SDL_CreateTexture(renderer,
-                                     SDL_PIXELFORMAT_RGBA8888,
-                                     SDL_TEXTUREACCESS_STREAMING,
-                                     width,
-                                     height);
-    if (!res->texture) {
-        return SDL_FALSE;
-    }
+        res->pixel_cache = malloc(sizeof(Uint32) * pixel_count);
+        if (!res->pixel_cache) {
+            SDL_DestroyTexture(res->texture);
+            res->texture = NULL;
+            if (item) {
+                rs_content_release(item);
+            }
+            return SDL_FALSE;
+        }
 
-    const size_t pixel_count = (size_t)width * (size_t)height;
-    res->pixel_cache = malloc(sizeof(Uint32) * pixel_count);
-    if (!res->pixel_cache) {
-        SDL_DestroyTexture(res->texture);
-        res->texture = NULL;
-        return SDL_FALSE;
+        texture_bytes = rs_calculate_texture_bytes(width, height, SDL_PIXELFORMAT_RGBA8888);
+        if (metrics) {
+            rs_memory_track_bytes(metrics, 0, texture_bytes);
+        }
+        manager->total_allocated_bytes += texture_bytes;
     }
+
+    const Uint64 allocated_time = SDL_GetPerformanceCounter();
+    manager->alloc_ms[manager->mode] += (double)(allocated_time - start_time) /
+                                        (double)SDL_GetPerformanceFrequency() * 1000.0;
+    manager->alloc_count[manager->mode]++;
+
+    res->width = width;
+    res->height = height;
     res->pixel_capacity = pixel_count;
     res->format = SDL_PIXELFORMAT_RGBA8888;
     res->dirty = SDL_TRUE;
 
-    rs_generate_texture_data(res->pixel_cache, width, height, phase, pattern);
-
-    // Update texture
-    void *texture_pixels;
-    int pitch;
-    if (SDL_LockTexture(res->texture, NULL, &texture_pixels, &pitch) == 0) {
-        (void)pitch;
-        rs_neon_copy_u32((uint32_t *)texture_pixels,
-                         res->pixel_cache,
-                         res->pixel_capacity);
-        SDL_UnlockTexture(res->texture);
-    }
+    rs_fill_resource(res, item, phase, pattern);
 
     Uint64 end_time = SDL_GetPerformanceCounter();
     if (metrics) {
         double allocation_time = (double)(end_time - start_time) /
                                (double)SDL_GetPerformanceFrequency() * 1000.0;
         metrics->allocation_time_ms += allocation_time;
-        metrics->resource_allocations++;
-
-        Uint32 texture_bytes = rs_calculate_texture_bytes(width, height, SDL_PIXELFORMAT_RGBA8888);
-        metrics->memory_allocated_bytes += texture_bytes;
-        if (metrics->memory_allocated_bytes > metrics->memory_peak_bytes) {
-            metrics->memory_peak_bytes = metrics->memory_allocated_bytes;
+        if (allocated) {
+            metrics->resource_allocations++;
         }
 
-        g_resource_manager.total_allocation_time_ms += allocation_time;
-        g_resource_manager.total_allocated_bytes += texture_bytes;
-        g_resource_manager.allocation_count++;
+        manager->total_allocation_time_ms += allocation_time;
+        manager->allocation_count++;
 
-        if (g_resource_manager.total_allocated_bytes > g_resource_manager.peak_allocated_bytes) {
-            g_resource_manager.peak_allocated_bytes = g_resource_manager.total_allocated_bytes;
+        if (manager->total_allocated_bytes > manager->peak_allocated_bytes) {
+            manager->peak_allocated_bytes = manager->total_allocated_bytes;
         }
     }
 
@@ -198,31 +587,99 @@ static SDL_bool rs_create_dynamic_texture(ResourceTexture *res,
 
 static void rs_destroy_resource_texture(ResourceTexture *res, BenchMetrics *metrics)
 {
+    ResourceManager *manager = &g_resource_manager;
     if (!res || !res->texture) {
         return;
     }
 
-    if (metrics) {
+    rs_content_cancel((int)(res - manager->textures));
+
+    if (res->pooled) {
+        // Back to the pool; the texture only dies if the budget evicts it
+        const Uint64 resident_before = manager->pool.resident_bytes;
+        const Uint64 evictions_before = manager->pool.evictions;
+        rs_texture_pool_release(&manager->pool, res->pooled);
+        if (metrics) {
+            rs_memory_track_bytes(metrics, resident_before, manager->pool.resident_bytes);
+            metrics->resource_deallocations += manager->pool.evictions - evictions_before;
+        }
+        manager->total_allocated_bytes = manager->pool.resident_bytes;
+        manager->deallocation_count++;
+    } else {
         Uint32 texture_bytes = rs_calculate_texture_bytes(res->width, res->height,
                                                          SDL_PIXELFORMAT_RGBA8888);
-        metrics->memory_allocated_bytes -= texture_bytes;
-        metrics->resource_deallocations++;
+        if (metrics) {
+            rs_memory_track_bytes(metrics, texture_bytes, 0);
+            metrics->resource_deallocations++;
+        }
+        manager->total_allocated_bytes -= texture_bytes;
+        manager->deallocation_count++;
 
-        g_resource_manager.total_allocated_bytes -= texture_bytes;
-        g_resource_manager.deallocation_count++;
+        SDL_DestroyTexture(res->texture);
+        free(res->pixel_cache);
     }
 
-    SDL_DestroyTexture(res->texture);
     res->texture = NULL;
-    if (res->pixel_cache) {
-        free(res->pixel_cache);
-        res->pixel_cache = NULL;
-    }
+    res->pixel_cache = NULL;
+    res->pooled = NULL;
     res->pixel_capacity = 0;
     res->in_use = SDL_FALSE;
     res->dirty = SDL_FALSE;
 }
 
+// Adds what the manager counted since the last fold to the totals in state,
+// so tearing the scene down and re-initialising it keeps them
+static void rs_memory_fold_stats(RenderSuiteState *state)
+{
+    ResourceManager *manager = &g_resource_manager;
+    for (int mode = 0; mode < RS_MEMORY_MODE_MAX; ++mode) {
+        state->memory_alloc_ms[mode] += manager->alloc_ms[mode];
+        state->memory_alloc_count[mode] += manager->alloc_count[mode];
+        manager->alloc_ms[mode] = 0.0;
+        manager->alloc_count[mode] = 0;
+    }
+    state->memory_content_misses += manager->content_misses;
+    manager->content_misses = 0;
+
+    const RSTexturePool *pool = &manager->pool;
+    state->memory_pool_hits += pool->hits - manager->pool_hits_folded;
+    state->memory_pool_misses += pool->misses - manager->pool_misses_folded;
+    state->memory_pool_evictions += pool->evictions - manager->pool_evictions_folded;
+    manager->pool_hits_folded = pool->hits;
+    manager->pool_misses_folded = pool->misses;
+    manager->pool_evictions_folded = pool->evictions;
+
+    const Uint64 lookups = state->memory_pool_hits + state->memory_pool_misses;
+    state->memory_pool_hit_rate = lookups ? (double)state->memory_pool_hits / (double)lookups : 0.0;
+}
+
+// Retires every live resource, then swaps allocation strategy. Leaving pooled
+// mode frees the idle textures too so churn starts from an empty heap.
+static void rs_memory_set_mode(RenderSuiteState *state, SDL_Renderer *renderer, int mode,
+                               BenchMetrics *metrics)
+{
+    ResourceManager *manager = &g_resource_manager;
+    for (int i = 0; i < MAX_DYNAMIC_TEXTURES; i++) {
+        if (manager->textures[i].in_use) {
+            rs_destroy_resource_texture(&manager->textures[i], metrics);
+        }
+    }
+    manager->active_count = 0;
+
+    if (metrics) {
+        rs_memory_track_bytes(metrics, manager->pool.resident_bytes, 0);
+    }
+    // The new pool starts its counters from zero
+    rs_memory_fold_stats(state);
+    manager->pool_hits_folded = 0;
+    manager->pool_misses_folded = 0;
+    manager->pool_evictions_folded = 0;
+    rs_texture_pool_shutdown(&manager->pool);
+    rs_texture_pool_init(&manager->pool, renderer, MEMORY_POOL_BUDGET);
+    manager->total_allocated_bytes = 0;
+    manager->mode = mode;
+}
+
 static void rs_update_resource_pool(SDL_Renderer *renderer, float stress_factor,
                                     float phase, float delta_seconds, BenchMetrics *metrics)
 {
@@ -257,19 +714,23 @@ static void rs_update_resource_pool(SDL_Renderer *renderer, float stress_factor,
             break; // No free slots
         }
 
-        // Create new texture with random size and pattern
+        // Create new texture with random size and pattern, taken from a
+        // creation order when the producer has one ready
+        StagingSlot *item = rs_content_claim(-1);
         int width = MIN_TEXTURE_SIZE + (rand() % (MAX_TEXTURE_SIZE - MIN_TEXTURE_SIZE));
         int height = MIN_TEXTURE_SIZE + (rand() % (MAX_TEXTURE_SIZE - MIN_TEXTURE_SIZE));
         int pattern = rand() % 4;
+        if (item) {
+            width = item->width;
+            height = item->height;
+            pattern = item->pattern;
+        }
 
         // Vary texture lifetime based on stress
         float lifetime = 1.0f + (float)rand() / RAND_MAX * (3.0f + stress_factor * 2.0f);
 
         ResourceTexture *res = &g_resource_manager.textures[slot];
-        if (rs_create_dynamic_texture(res, renderer, width, height, phase, pattern, metrics)) {
-            res->width = width;
-            res->height = height;
-            res->format = SDL_PIXELFORMAT_RGBA8888;
+        if (rs_create_dynamic_texture(res, renderer, width, height, phase, pattern, item, metrics)) {
             res->allocation_time = SDL_GetPerformanceCounter();
             res->life_remaining = lifetime;
             res->in_use = SDL_TRUE;
@@ -281,6 +742,31 @@ static void rs_update_resource_pool(SDL_Renderer *renderer, float stress_factor,
     }
 }
 
+// Orders next frame's streaming updates at each resource's own size and
+// tops up the creation orders, so the producer works ahead of the render thread
+static void rs_content_order_ahead(int first_index, int updates, float phase)
+{
+    if (!g_content_producer.thread) {
+        return;
+    }
+
+    for (int i = 0; i < updates; i++) {
+        const int index = (first_index + i) % MAX_DYNAMIC_TEXTURES;
+        const ResourceTexture *res = &g_resource_manager.textures[index];
+        if (res->in_use && res->texture) {
+            rs_content_request(index, res->width, res->height, (index + i) % 4, phase + (float)i);
+        }
+    }
+
+    for (int orders = rs_content_creation_orders(); orders < STAGING_CREATE_AHEAD; orders++) {
+        rs_content_request(-1,
+                           MIN_TEXTURE_SIZE + (rand() % (MAX_TEXTURE_SIZE - MIN_TEXTURE_SIZE)),
+                           MIN_TEXTURE_SIZE + (rand() % (MAX_TEXTURE_SIZE - MIN_TEXTURE_SIZE)),
+                           rand() % 4,
+                           phase);
+    }
+}
+
 static void rs_render_resource_textures(SDL_Renderer *renderer, float phase,
                                         int region_height, float top_margin,
                                         BenchMetrics *metrics)
@@ -318,8 +804,9 @@ static void rs_render_resource_textures(SDL_Renderer *renderer, float phase,
             float w = cell_width * 0.8f * scale;
             float h = cell_height * 0.8f * scale;
 
+            const SDL_Rect src = {0, 0, res->width, res->height};
             SDL_FRect dest = {x + (cell_width - w) * 0.5f, y + (cell_height - h) * 0.5f, w, h};
-            SDL_RenderCopyF(renderer, res->texture, NULL, &dest);
+            SDL_RenderCopyF(renderer, res->texture, &src, &dest);
 
             if (metrics) {
                 metrics->draw_calls++;
@@ -335,16 +822,19 @@ static void rs_render_resource_textures(SDL_Renderer *renderer, float phase,
 
 void rs_scene_memory_init(RenderSuiteState *state, SDL_Renderer *renderer)
 {
-    (void)state;
-    (void)renderer;
-
     // Initialize resource manager
     memset(&g_resource_manager, 0, sizeof(g_resource_manager));
+    rs_texture_pool_init(&g_resource_manager.pool, renderer, MEMORY_POOL_BUDGET);
+
+    // Mode and async selection persist in state and are re-applied by the first frame
+    (void)state;
 }
 
 void rs_scene_memory_cleanup(RenderSuiteState *state)
 {
-    (void)state;
+    if (state) {
+        rs_memory_fold_stats(state);
+    }
 
     // Clean up all resources
     for (int i = 0; i < MAX_DYNAMIC_TEXTURES; i++) {
@@ -352,6 +842,8 @@ void rs_scene_memory_cleanup(RenderSuiteState *state)
             rs_destroy_resource_texture(&g_resource_manager.textures[i], NULL);
         }
     }
+    rs_texture_pool_shutdown(&g_resource_manager.pool);
+    rs_content_producer_stop();
     memset(&g_resource_manager, 0, sizeof(g_resource_manager));
 }
 
@@ -367,6 +859,17 @@ void rs_scene_memory(RenderSuiteState *state,
     const float factor = rs_state_stress_factor(state);
     const int region_height = SDL_max(1, BENCH_SCREEN_H - (int)state->top_margin);
 
+    if (state->memory_mode != g_resource_manager.mode) {
+        rs_memory_set_mode(state, renderer, state->memory_mode, metrics);
+    }
+    if (state->memory_async != (g_content_producer.thread != NULL)) {
+        if (state->memory_async) {
+            state->memory_async = rs_content_producer_start();
+        } else {
+            rs_content_producer_stop();
+        }
+    }
+
     // Update animation phase
     state->resources_phase += (float)(delta_seconds * (1.0f + factor * 2.0f));
 
@@ -383,20 +886,8 @@ void rs_scene_memory(RenderSuiteState *state,
             Uint64 start_time = SDL_GetPerformanceCounter();
 
             // Update texture with new pattern
-            void *pixels;
-            int pitch;
-            if (SDL_LockTexture(res->texture, NULL, &pixels, &pitch) == 0) {
-                (void)pitch;
-                rs_generate_texture_data(res->pixel_cache,
-                                         res->width,
-                                         res->height,
-                                         state->resources_phase + (float)i,
-                                         (update_index + i) % 4);
-                rs_neon_copy_u32((uint32_t *)pixels,
-                                 res->pixel_cache,
-                                 res->pixel_capacity);
-                SDL_UnlockTexture(res->texture);
-
+            if (rs_fill_resource(res, rs_content_claim(update_index),
+                                 state->resources_phase + (float)i, (update_index + i) % 4)) {
                 Uint64 end_time = SDL_GetPerformanceCounter();
                 if (metrics) {
                     double update_time = (double)(end_time - start_time) /
@@ -407,6 +898,17 @@ void rs_scene_memory(RenderSuiteState *state,
         }
     }
     state->resource_allocation_index = (state->resource_allocation_index + updates_per_frame) % MAX_DYNAMIC_TEXTURES;
+    rs_content_order_ahead(state->resource_allocation_index, updates_per_frame, state->resources_phase);
+
+    state->memory_upload_ms += g_resource_manager.frame_upload_ms;
+    state->memory_upload_frames++;
+    g_resource_manager.frame_upload_ms = 0.0;
+    rs_content_producer_stats(state);
+
+    rs_memory_fold_stats(state);
+    state->memory_pool_waste = rs_texture_pool_waste(&g_resource_manager.pool);
+    state->memory_pool_resident_bytes = g_resource_manager.pool.resident_bytes;
+    state->memory_pool_budget_bytes = g_resource_manager.pool.budget_bytes;
 
     // Render all active textures
     rs_render_resource_textures(renderer, state->resources_phase, region_height,
@@ -0,0 +1,641 @@
+#include "render_suite/scenes/pixel_kernels.h"
+#include "render_suite/render_neon.h"
+
+#include <math.h>
+
+#define RS_INV_TWO_PI 0.15915494309189533577f
+
+// Plasma constants mirror rs_generate_plasma: coordinate scale and phase rates
+#define PLASMA_SCALE 0.02f
+#define PLASMA_TIME_SCALE 0.1f
+
+#define FIRE_DIV6_MUL 10924  // (sum * 10924) >> 16 == sum / 6 for every sum <= 6 * 255
+#define FIRE_RNG_LANES 4     // Four xorshift words give 16 two-bit cooling draws
+#define FIRE_CHUNK 16
+
+#define LIFE_DEAD 0xFF000000u
+
+static inline Uint32 rs_pack_rgba(Uint32 r, Uint32 g, Uint32 b)
+{
+    return r | (g << 8) | (b << 16) | 0xFF000000u;
+}
+
+/*
+ * sin(2*pi*u) without a table: wrap u into (-0.5, 0.5], take the parabola
+ * 8w - 16w|w| and refine it once. Max error is about 0.001.
+ */
+static inline float rs_poly_sin_turns(float u)
+{
+    int whole = (int)u;
+    if ((float)whole > u) {
+        whole--;
+    }
+    const float w = 0.5f - (u - (float)whole);
+    const float p = w * (8.0f - 16.0f * fabsf(w));
+    return p * (0.775f + 0.225f * fabsf(p));
+}
+
+static inline Uint32 rs_plasma_channel(float turns)
+{
+    const int value = (int)((rs_poly_sin_turns(turns) + 1.0f) * 127.5f);
+    return (Uint32)(value < 0 ? 0 : (value > 255 ? 255 : value));
+}
+
+#if RS_HAS_NEON
+static inline float32x4_t rs_poly_sin_turns_neon(float32x4_t u)
+{
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    float32x4_t whole = vcvtq_f32_s32(vcvtq_s32_f32(u));
+    const uint32x4_t over = vcgtq_f32(whole, u);
+    whole = vsubq_f32(whole, vreinterpretq_f32_u32(vandq_u32(over, vreinterpretq_u32_f32(one))));
+
+    const float32x4_t w = vsubq_f32(vdupq_n_f32(0.5f), vsubq_f32(u, whole));
+    const float32x4_t p = vmulq_f32(w, vmlsq_n_f32(vdupq_n_f32(8.0f), vabsq_f32(w), 16.0f));
+    return vmulq_f32(p, vmlaq_n_f32(vdupq_n_f32(0.775f), vabsq_f32(p), 0.225f));
+}
+
+static inline uint32x4_t rs_plasma_channel_neon(float32x4_t turns)
+{
+    const float32x4_t scaled = vmulq_n_f32(vaddq_f32(rs_poly_sin_turns_neon(turns), vdupq_n_f32(1.0f)), 127.5f);
+    return vminq_u32(vcvtq_u32_f32(scaled), vdupq_n_u32(255));
+}
+
+// sqrt(x) = x * rsqrt(x) with one Newton step; x is kept away from zero
+static inline float32x4_t rs_sqrt_neon(float32x4_t x)
+{
+    x = vmaxq_f32(x, vdupq_n_f32(1e-12f));
+    float32x4_t r = vrsqrteq_f32(x);
+    r = vmulq_f32(r, vrsqrtsq_f32(vmulq_f32(x, r), r));
+    return vmulq_f32(x, r);
+}
+#endif
+
+void rs_plasma_rows(Uint32 *pixels, int width, int row_start, int row_end, float phase)
+{
+    const float t = phase * PLASMA_TIME_SCALE;
+
+    // All sine arguments are carried in turns and advance by a constant per
+    // pixel, so each row only needs its starting phase.
+    const float v1_step = 4.0f * PLASMA_SCALE * RS_INV_TWO_PI;
+    const float v3_step = 2.0f * PLASMA_SCALE * RS_INV_TWO_PI;
+    const float v1_base = t * RS_INV_TWO_PI;
+
+    for (int y = row_start; y < row_end; y++) {
+        const float fy = (float)y * PLASMA_SCALE;
+        const float v2 = rs_poly_sin_turns((fy * 3.0f + t * 1.3f) * RS_INV_TWO_PI);
+        const float v3_base = (fy * 2.0f + t * 0.7f) * RS_INV_TWO_PI;
+        const float v4_offset = t * 1.5f * RS_INV_TWO_PI;
+        const float v4_scale = 5.0f * RS_INV_TWO_PI;
+        Uint32 *row = pixels + (size_t)y * (size_t)width;
+
+        int x = 0;
+#if RS_HAS_NEON
+        static const float lane_offsets[4] = {0.0f, 1.0f, 2.0f, 3.0f};
+        const float32x4_t lanes = vld1q_f32(lane_offsets);
+        float32x4_t u1 = vmlaq_n_f32(vdupq_n_f32(v1_base), lanes, v1_step);
+        float32x4_t u3 = vmlaq_n_f32(vdupq_n_f32(v3_base), lanes, v3_step);
+        float32x4_t fx = vmulq_n_f32(lanes, PLASMA_SCALE);
+        const float32x4_t u1_step4 = vdupq_n_f32(v1_step * 4.0f);
+        const float32x4_t u3_step4 = vdupq_n_f32(v3_step * 4.0f);
+        const float32x4_t fx_step4 = vdupq_n_f32(PLASMA_SCALE * 4.0f);
+        const float32x4_t fy2 = vdupq_n_f32(fy * fy);
+        const float32x4_t v2v = vdupq_n_f32(v2);
+        const float32x4_t v4_offset_v = vdupq_n_f32(v4_offset);
+        const float32x4_t g_offset = vdupq_n_f32(0.33f);
+        const float32x4_t b_offset = vdupq_n_f32(0.665f);
+        const uint32x4_t alpha = vdupq_n_u32(0xFF000000u);
+
+        for (; x + 4 <= width; x += 4) {
+            const float32x4_t dist = rs_sqrt_neon(vmlaq_f32(fy2, fx, fx));
+            float32x4_t sum = vaddq_f32(rs_poly_sin_turns_neon(u1), v2v);
+            sum = vaddq_f32(sum, rs_poly_sin_turns_neon(u3));
+            sum = vaddq_f32(sum, rs_poly_sin_turns_neon(vmlaq_n_f32(v4_offset_v, dist, v4_scale)));
+
+            // intensity in [0, 1]; channel phases are intensity turns apart
+            const float32x4_t intensity = vmlaq_n_f32(vdupq_n_f32(0.5f), sum, 0.125f);
+            const uint32x4_t r = rs_plasma_channel_neon(intensity);
+            const uint32x4_t g = rs_plasma_channel_neon(vaddq_f32(intensity, g_offset));
+            const uint32x4_t b = rs_plasma_channel_neon(vaddq_f32(intensity, b_offset));
+
+            uint32x4_t packed = vorrq_u32(r, vshlq_n_u32(g, 8));
+            packed = vorrq_u32(packed, vshlq_n_u32(b, 16));
+            vst1q_u32(row + x, vorrq_u32(packed, alpha));
+
+            u1 = vaddq_f32(u1, u1_step4);
+            u3 = vaddq_f32(u3, u3_step4);
+            fx = vaddq_f32(fx, fx_step4);
+        }
+#endif
+        float u1_scalar = v1_base + (float)x * v1_step;
+        float u3_scalar = v3_base + (float)x * v3_step;
+        float fx_scalar = (float)x * PLASMA_SCALE;
+        for (; x < width; x++) {
+            const float dist = sqrtf(fx_scalar * fx_scalar + fy * fy);
+            const float sum = rs_poly_sin_turns(u1_scalar) + v2 +
+                              rs_poly_sin_turns(u3_scalar) +
+                              rs_poly_sin_turns(v4_offset + dist * v4_scale);
+            const float intensity = 0.5f + sum * 0.125f;
+            row[x] = rs_pack_rgba(rs_plasma_channel(intensity),
+                                  rs_plasma_channel(intensity + 0.33f),
+                                  rs_plasma_channel(intensity + 0.665f));
+            u1_scalar += v1_step;
+            u3_scalar += v3_step;
+            fx_scalar += PLASMA_SCALE;
+        }
+    }
+}
+
+/* ---- Mandelbrot ---------------------------------------------------------- */
+
+void rs_mandel_view_init(RSMandelView *view,
+                         float center_x,
+                         float center_y,
+                         float zoom,
+                         int max_iterations,
+                         float phase)
+{
+    view->center_x = center_x;
+    view->center_y = center_y;
+    view->zoom = zoom;
+    view->max_iterations = SDL_clamp(max_iterations, 1, RS_MANDEL_MAX_ITERATIONS);
+
+    // Same HSV ramp as rs_generate_mandelbrot, evaluated once per count
+    for (int n = 0; n < view->max_iterations; n++) {
+        float t = (float)n / (float)view->max_iterations;
+        float hue = t * 6.0f + phase * 0.5f;
+        int hi = (int)hue % 6;
+        float f = hue - (float)hi;
+        float sat = 1.0f;
+        float val = t;
+
+        float p = val * (1.0f - sat);
+        float q = val * (1.0f - sat * f);
+        float r = val * (1.0f - sat * (1.0f - f));
+
+        float rf, gf, bf;
+        switch (hi) {
+            case 0: rf = val; gf = r; bf = p; break;
+            case 1: rf = q; gf = val; bf = p; break;
+            case 2: rf = p; gf = val; bf = r; break;
+            case 3: rf = p; gf = q; bf = val; break;
+            case 4: rf = r; gf = p; bf = val; break;
+            default: rf = val; gf = p; bf = q; break;
+        }
+        view->palette[n] = rs_pack_rgba((Uint32)SDL_clamp((int)(rf * 255), 0, 255),
+                                        (Uint32)SDL_clamp((int)(gf * 255), 0, 255),
+                                        (Uint32)SDL_clamp((int)(bf * 255), 0, 255));
+    }
+    view->palette[view->max_iterations] = rs_pack_rgba(0, 0, 0);
+}
+
+typedef struct {
+    Uint32 *pixels;
+    int width;
+    int height;
+    int row_end;
+    int step;
+    int offset_x;
+    int fill;
+    int x;
+    int y;
+    const RSMandelView *view;
+    RSMandelStats *stats;
+} MandelQueue;
+
+static void rs_mandel_store(const MandelQueue *queue, int x, int y, Uint32 colour)
+{
+    const int x1 = SDL_min(x + queue->fill, queue->width);
+    const int y1 = SDL_min(y + queue->fill, queue->height);
+    for (int row = y; row < y1; row++) {
+        Uint32 *out = queue->pixels + (size_t)row * (size_t)queue->width;
+        for (int col = x; col < x1; col++) {
+            out[col] = colour;
+        }
+    }
+}
+
+// Main cardioid and period-2 bulb never escape, so they go straight to black
+static inline SDL_bool rs_mandel_interior(float cr, float ci)
+{
+    const float xq = cr - 0.25f;
+    const float ci2 = ci * ci;
+    const float q = xq * xq + ci2;
+    if (q * (q + xq) <= 0.25f * ci2) {
+        return SDL_TRUE;
+    }
+    const float xb = cr + 1.0f;
+    return (xb * xb + ci2 <= 0.0625f) ? SDL_TRUE : SDL_FALSE;
+}
+
+// Work queue over the band's lattice; interior samples are resolved inline
+static SDL_bool rs_mandel_next(MandelQueue *queue, int *out_x, int *out_y, float *cr, float *ci)
+{
+    const RSMandelView *view = queue->view;
+    while (queue->y < queue->row_end) {
+        const int x = queue->x;
+        const int y = queue->y;
+        queue->x += queue->step;
+        if (queue->x >= queue->width) {
+            queue->x = queue->offset_x;
+            queue->y += queue->step;
+        }
+
+        // Matches the reference expression order so results are identical
+        const float real = view->center_x + ((float)x / (float)queue->width - 0.5f) * 4.0f / view->zoom;
+        const float imag = view->center_y + ((float)y / (float)queue->height - 0.5f) * 4.0f / view->zoom;
+        if (rs_mandel_interior(real, imag)) {
+            rs_mandel_store(queue, x, y, view->palette[view->max_iterations]);
+            queue->stats->skipped++;
+            continue;
+        }
+
+        *out_x = x;
+        *out_y = y;
+        *cr = real;
+        *ci = imag;
+        return SDL_TRUE;
+    }
+    return SDL_FALSE;
+}
+
+#if RS_HAS_NEON
+// Four lanes iterate together; a lane that escapes or hits the limit is
+// retired and immediately refilled from the queue, so no lane idles while
+// its neighbours finish long orbits.
+static void rs_mandel_lanes_neon(MandelQueue *queue)
+{
+    const RSMandelView *view = queue->view;
+    float cr_lanes[4] = {0};
+    float ci_lanes[4] = {0};
+    float zr_lanes[4] = {0};
+    float zi_lanes[4] = {0};
+    uint32_t iter_lanes[4] = {0};
+    uint32_t done_lanes[4];
+    int lane_x[4];
+    int lane_y[4];
+    SDL_bool active[4];
+    int active_count = 0;
+
+    for (int lane = 0; lane < 4; lane++) {
+        active[lane] = rs_mandel_next(queue, &lane_x[lane], &lane_y[lane], &cr_lanes[lane], &ci_lanes[lane]);
+        active_count += active[lane] ? 1 : 0;
+    }
+
+    const float32x4_t four = vdupq_n_f32(4.0f);
+    const uint32x4_t max_iter = vdupq_n_u32((uint32_t)view->max_iterations);
+    const uint32x4_t one = vdupq_n_u32(1);
+    float32x4_t cr = vld1q_f32(cr_lanes);
+    float32x4_t ci = vld1q_f32(ci_lanes);
+    float32x4_t zr = vdupq_n_f32(0.0f);
+    float32x4_t zi = vdupq_n_f32(0.0f);
+    uint32x4_t iter = vdupq_n_u32(0);
+
+    while (active_count > 0) {
+        const float32x4_t zr2 = vmulq_f32(zr, zr);
+        const float32x4_t zi2 = vmulq_f32(zi, zi);
+        const uint32x4_t done = vorrq_u32(vcgeq_f32(vaddq_f32(zr2, zi2), four),
+                                          vcgeq_u32(iter, max_iter));
+        const uint32x2_t any = vorr_u32(vget_low_u32(done), vget_high_u32(done));
+
+        if (vget_lane_u32(any, 0) | vget_lane_u32(any, 1)) {
+            vst1q_u32(done_lanes, done);
+            vst1q_f32(cr_lanes, cr);
+            vst1q_f32(ci_lanes, ci);
+            vst1q_f32(zr_lanes, zr);
+            vst1q_f32(zi_lanes, zi);
+            vst1q_u32(iter_lanes, iter);
+
+            for (int lane = 0; lane < 4; lane++) {
+                if (!done_lanes[lane]) {
+                    continue;
+                }
+                if (active[lane]) {
+                    rs_mandel_store(queue, lane_x[lane], lane_y[lane], view->palette[iter_lanes[lane]]);
+                    queue->stats->iterations += iter_lanes[lane];
+                    active_count--;
+                }
+                active[lane] = rs_mandel_next(queue, &lane_x[lane], &lane_y[lane],
+                                              &cr_lanes[lane], &ci_lanes[lane]);
+                if (active[lane]) {
+                    active_count++;
+                } else {
+                    cr_lanes[lane] = 0.0f;
+                    ci_lanes[lane] = 0.0f;
+                }
+                zr_lanes[lane] = 0.0f;
+                zi_lanes[lane] = 0.0f;
+                iter_lanes[lane] = 0;
+            }
+
+            cr = vld1q_f32(cr_lanes);
+            ci = vld1q_f32(ci_lanes);
+            zr = vld1q_f32(zr_lanes);
+            zi = vld1q_f32(zi_lanes);
+            iter = vld1q_u32(iter_lanes);
+            continue;
+        }
+
+        zi = vmlaq_f32(ci, vaddq_f32(zr, zr), zi);
+        zr = vaddq_f32(vsubq_f32(zr2, zi2), cr);
+        iter = vaddq_u32(iter, one);
+    }
+}
+#endif
+
+static void rs_mandel_scalar(MandelQueue *queue)
+{
+    const RSMandelView *view = queue->view;
+    const int max_iterations = view->max_iterations;
+    int x = 0;
+    int y = 0;
+    float real = 0.0f;
+    float imag = 0.0f;
+
+    while (rs_mandel_next(queue, &x, &y, &real, &imag)) {
+        float zr = 0.0f, zi = 0.0f;
+        int iterations = 0;
+
+        while (iterations < max_iterations && (zr * zr + zi * zi) < 4.0f) {
+            float temp = zr * zr - zi * zi + real;
+            zi = 2.0f * zr * zi + imag;
+            zr = temp;
+            iterations++;
+        }
+
+        rs_mandel_store(queue, x, y, view->palette[iterations]);
+        queue->stats->iterations += (Uint32)iterations;
+    }
+}
+
+void rs_mandel_rows(Uint32 *pixels,
+                    int width,
+                    int height,
+                    int row_start,
+                    int row_end,
+                    const RSMandelView *view,
+                    int step,
+                    int offset_x,
+                    int offset_y,
+                    int fill,
+                    RSMandelStats *stats)
+{
+    if (!pixels || !view || !stats || step <= 0 || offset_x >= width) {
+        return;
+    }
+
+    MandelQueue queue;
+    queue.pixels = pixels;
+    queue.width = width;
+    queue.height = height;
+    queue.row_end = SDL_min(row_end, height);
+    queue.step = step;
+    queue.offset_x = offset_x;
+    queue.fill = SDL_max(fill, 1);
+    queue.x = offset_x;
+    queue.y = row_start + ((offset_y - row_start % step) + step) % step;
+    queue.view = view;
+    queue.stats = stats;
+
+#if RS_HAS_NEON
+    rs_mandel_lanes_neon(&queue);
+#else
+    rs_mandel_scalar(&queue);
+#endif
+}
+
+static inline Uint32 rs_fire_xorshift(Uint32 x)
+{
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return x;
+}
+
+static void rs_fire_seed_row(Uint32 lanes[FIRE_RNG_LANES], Uint32 seed, int y)
+{
+    Uint32 state = (seed ^ ((Uint32)y * 0x9E3779B9u)) | 1u;
+    for (int l = 0; l < FIRE_RNG_LANES; l++) {
+        state = rs_fire_xorshift(state);
+        lanes[l] = state | 1u;
+    }
+}
+
+// Scalar mirror of the NEON chunk: same lane order, same cooling bits
+static void rs_fire_chunk_scalar(const Uint8 *above, const Uint8 *below, Uint8 *out,
+                                 const Uint32 lanes[FIRE_RNG_LANES], int count)
+{
+    for (int i = 0; i < count; i++) {
+        const Uint32 sum = (Uint32)above[i] + above[i + 1] + above[i + 2] +
+                           below[i] + below[i + 1] + below[i + 2];
+        const int average = (int)((sum * FIRE_DIV6_MUL) >> 16);
+        const int cooling = 2 + (int)((lanes[i >> 2] >> ((i & 3) * 8)) & 3u);
+        const int value = average - cooling;
+        out[i] = (Uint8)(value > 0 ? value : 0);
+    }
+}
+
+void rs_fire_rows(const Uint8 *src,
+                  Uint8 *dst,
+                  int width,
+                  int stride,
+                  int row_start,
+                  int row_end,
+                  Uint32 seed)
+{
+    for (int y = row_start; y < row_end; y++) {
+        // Row y starts at its left pad so index x reads neighbour x - 1
+        const Uint8 *above = src + (size_t)y * (size_t)stride;
+        const Uint8 *below = above + stride;
+        Uint8 *out = dst + (size_t)y * (size_t)stride + 1;
+        Uint32 lanes[FIRE_RNG_LANES];
+        rs_fire_seed_row(lanes, seed, y);
+
+        int x = 0;
+#if RS_HAS_NEON
+        uint32x4_t rng = vld1q_u32(lanes);
+        const int16x8_t div6 = vdupq_n_s16(FIRE_DIV6_MUL / 2); // vqdmulh doubles the product
+        const uint8x16_t mask = vdupq_n_u8(3);
+        const uint8x16_t base = vdupq_n_u8(2);
+
+        for (; x + FIRE_CHUNK <= width; x += FIRE_CHUNK) {
+            const uint8x16_t a0 = vld1q_u8(above + x);
+            const uint8x16_t a1 = vld1q_u8(above + x + 1);
+            const uint8x16_t a2 = vld1q_u8(above + x + 2);
+            const uint8x16_t b0 = vld1q_u8(below + x);
+            const uint8x16_t b1 = vld1q_u8(below + x + 1);
+            const uint8x16_t b2 = vld1q_u8(below + x + 2);
+
+            uint16x8_t lo = vaddl_u8(vget_low_u8(a0), vget_low_u8(a1));
+            lo = vaddw_u8(lo, vget_low_u8(a2));
+            lo = vaddw_u8(lo, vget_low_u8(b0));
+            lo = vaddw_u8(lo, vget_low_u8(b1));
+            lo = vaddw_u8(lo, vget_low_u8(b2));
+            uint16x8_t hi = vaddl_u8(vget_high_u8(a0), vget_high_u8(a1));
+            hi = vaddw_u8(hi, vget_high_u8(a2));
+            hi = vaddw_u8(hi, vget_high_u8(b0));
+            hi = vaddw_u8(hi, vget_high_u8(b1));
+            hi = vaddw_u8(hi, vget_high_u8(b2));
+
+            lo = vreinterpretq_u16_s16(vqdmulhq_s16(vreinterpretq_s16_u16(lo), div6));
+            hi = vreinterpretq_u16_s16(vqdmulhq_s16(vreinterpretq_s16_u16(hi), div6));
+            const uint8x16_t average = vcombine_u8(vmovn_u16(lo), vmovn_u16(hi));
+
+            rng = veorq_u32(rng, vshlq_n_u32(rng, 13));
+            rng = veorq_u32(rng, vshrq_n_u32(rng, 17));
+            rng = veorq_u32(rng, vshlq_n_u32(rng, 5));
+            const uint8x16_t cooling = vaddq_u8(vandq_u8(vreinterpretq_u8_u32(rng), mask), base);
+
+            vst1q_u8(out + x, vqsubq_u8(average, cooling));
+        }
+        vst1q_u32(lanes, rng);
+#endif
+        for (; x < width; x += FIRE_CHUNK) {
+            for (int l = 0; l < FIRE_RNG_LANES; l++) {
+                lanes[l] = rs_fire_xorshift(lanes[l]);
+            }
+            const int count = SDL_min(FIRE_CHUNK, width - x);
+            rs_fire_chunk_scalar(above + x, below + x, out + x, lanes, count);
+        }
+    }
+}
+
+/*
+ * Neighbour counts are bit-sliced: every bit position of a word is a separate
+ * cell, so adders built from AND/XOR count 32 cells at once. The count only
+ * needs to be known mod 8 because 8 neighbours kills a cell just like 0 does.
+ */
+static inline Uint32 rs_life_word(Uint32 up_w, Uint32 up, Uint32 up_e,
+                                  Uint32 mid_w, Uint32 mid, Uint32 mid_e,
+                                  Uint32 down_w, Uint32 down, Uint32 down_e)
+{
+    // Per-row sums: two full adders for the outer rows, a half adder for the middle
+    const Uint32 u_x = up_w ^ up;
+    const Uint32 u0 = u_x ^ up_e;
+    const Uint32 u1 = (up_w & up) | (u_x & up_e);
+    const Uint32 m0 = mid_w ^ mid_e;
+    const Uint32 m1 = mid_w & mid_e;
+    const Uint32 d_x = down_w ^ down;
+    const Uint32 d0 = d_x ^ down_e;
+    const Uint32 d1 = (down_w & down) | (d_x & down_e);
+
+    // Add the three 2-bit partial counts
+    const Uint32 ones_x = u0 ^ m0;
+    const Uint32 s0 = ones_x ^ d0;
+    const Uint32 c0 = (u0 & m0) | (ones_x & d0);
+    const Uint32 twos_x = u1 ^ m1;
+    const Uint32 t0 = twos_x ^ d1;
+    const Uint32 t1 = (u1 & m1) | (twos_x & d1);
+    const Uint32 s1 = c0 ^ t0;
+    const Uint32 s2 = t1 ^ (c0 & t0);
+
+    // Alive next if count == 3, or count == 2 and alive now
+    return s1 & ~s2 & (s0 | mid);
+}
+
+#if RS_HAS_NEON
+static inline uint32x4_t rs_life_west_neon(const Uint32 *p)
+{
+    return vorrq_u32(vshlq_n_u32(vld1q_u32(p), 1), vshrq_n_u32(vld1q_u32(p - 1), 31));
+}
+
+static inline uint32x4_t rs_life_east_neon(const Uint32 *p)
+{
+    return vorrq_u32(vshrq_n_u32(vld1q_u32(p), 1), vshlq_n_u32(vld1q_u32(p + 1), 31));
+}
+#endif
+
+void rs_life_rows(const Uint32 *src,
+                  Uint32 *dst,
+                  int words,
+                  int stride,
+                  int height,
+                  int row_start,
+                  int row_end)
+{
+    for (int y = row_start; y < row_end; y++) {
+        const Uint32 *up = src + (size_t)((y + height - 1) % height) * (size_t)stride;
+        const Uint32 *mid = src + (size_t)y * (size_t)stride;
+        const Uint32 *down = src + (size_t)((y + 1) % height) * (size_t)stride;
+        Uint32 *out = dst + (size_t)y * (size_t)stride;
+
+        int i = 0;
+#if RS_HAS_NEON
+        for (; i + 4 <= words; i += 4) {
+            const uint32x4_t u = vld1q_u32(up + i);
+            const uint32x4_t m = vld1q_u32(mid + i);
+            const uint32x4_t d = vld1q_u32(down + i);
+            const uint32x4_t uw = rs_life_west_neon(up + i);
+            const uint32x4_t ue = rs_life_east_neon(up + i);
+            const uint32x4_t mw = rs_life_west_neon(mid + i);
+            const uint32x4_t me = rs_life_east_neon(mid + i);
+            const uint32x4_t dw = rs_life_west_neon(down + i);
+            const uint32x4_t de = rs_life_east_neon(down + i);
+
+            const uint32x4_t u_x = veorq_u32(uw, u);
+            const uint32x4_t u0 = veorq_u32(u_x, ue);
+            const uint32x4_t u1 = vorrq_u32(vandq_u32(uw, u), vandq_u32(u_x, ue));
+            const uint32x4_t m0 = veorq_u32(mw, me);
+            const uint32x4_t m1 = vandq_u32(mw, me);
+            const uint32x4_t d_x = veorq_u32(dw, d);
+            const uint32x4_t d0 = veorq_u32(d_x, de);
+            const uint32x4_t d1 = vorrq_u32(vandq_u32(dw, d), vandq_u32(d_x, de));
+
+            const uint32x4_t ones_x = veorq_u32(u0, m0);
+            const uint32x4_t s0 = veorq_u32(ones_x, d0);
+            const uint32x4_t c0 = vorrq_u32(vandq_u32(u0, m0), vandq_u32(ones_x, d0));
+            const uint32x4_t twos_x = veorq_u32(u1, m1);
+            const uint32x4_t t0 = veorq_u32(twos_x, d1);
+            const uint32x4_t t1 = vorrq_u32(vandq_u32(u1, m1), vandq_u32(twos_x, d1));
+            const uint32x4_t s1 = veorq_u32(c0, t0);
+            const uint32x4_t s2 = veorq_u32(t1, vandq_u32(c0, t0));
+
+            vst1q_u32(out + i, vandq_u32(vbicq_u32(s1, s2), vorrq_u32(s0, m)));
+        }
+#endif
+        for (; i < words; i++) {
+            out[i] = rs_life_word((up[i] << 1) | (up[i - 1] >> 31), up[i], (up[i] >> 1) | (up[i + 1] << 31),
+                                  (mid[i] << 1) | (mid[i - 1] >> 31), mid[i], (mid[i] >> 1) | (mid[i + 1] << 31),
+                                  (down[i] << 1) | (down[i - 1] >> 31), down[i], (down[i] >> 1) | (down[i + 1] << 31));
+        }
+
+        out[-1] = out[words - 1];
+        out[words] = out[0];
+    }
+}
+
+void rs_life_unpack_row(Uint32 *pixels,
+                        const Uint32 *row,
+                        int x0,
+                        int count,
+                        const Uint32 *column_colour,
+                        const Uint32 *diagonal_colour,
+                        Uint32 row_colour)
+{
+    const int shift = x0 & 31;
+    const Uint32 *word = row + (x0 >> 5);
+
+    for (int x = 0; x < count; x += 32, word++) {
+        // 32 cells starting at bit x0 + x; the right pad covers the last word
+        const Uint32 bits = shift ? (word[0] >> shift) | (word[1] << (32 - shift)) : word[0];
+        const int chunk = SDL_min(32, count - x);
+
+        int k = 0;
+#if RS_HAS_NEON
+        static const Uint32 lane_bits[4] = {1u, 2u, 4u, 8u};
+        const uint32x4_t lane_mask = vld1q_u32(lane_bits);
+        const uint32x4_t dead = vdupq_n_u32(LIFE_DEAD);
+        const uint32x4_t row_rgb = vdupq_n_u32(row_colour);
+        for (; k + 4 <= chunk; k += 4) {
+            const uint32x4_t alive = vtstq_u32(vdupq_n_u32(bits >> k), lane_mask);
+            const uint32x4_t colour = vorrq_u32(vorrq_u32(vld1q_u32(column_colour + x + k),
+                                                          vld1q_u32(diagonal_colour + x + k)),
+                                                row_rgb);
+            vst1q_u32(pixels + x + k, vbslq_u32(alive, colour, dead));
+        }
+#endif
+        for (; k < chunk; k++) {
+            pixels[x + k] = ((bits >> k) & 1u) ?
+                (column_colour[x + k] | diagonal_colour[x + k] | row_colour) : LIFE_DEAD;
+        }
+    }
+}
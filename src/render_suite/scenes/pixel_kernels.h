@@ -0,0 +1,96 @@
+#ifndef RENDER_SUITE_SCENES_PIXEL_KERNELS_H
+#define RENDER_SUITE_SCENES_PIXEL_KERNELS_H
+
+#include <SDL2/SDL.h>
+
+/*
+ * Optimised pixel-scene kernels. Output matches the scene's Pixel32 layout
+ * (bytes r, g, b, a) packed into little-endian 32-bit words, and every kernel
+ * works on a row range so it can run as a worker-pool band.
+ */
+
+// Plasma with incremental per-row phase and a polynomial sine; NEON 4-lane
+// path with a scalar mirror for row tails and the tolerance check. Non-NEON
+// builds generate with rs_generate_plasma, which is faster without SIMD.
+void rs_plasma_rows(Uint32 *pixels, int width, int row_start, int row_end, float phase);
+
+#define RS_MANDEL_MAX_ITERATIONS 256
+
+// Frozen view parameters plus the iteration -> colour palette for one frame
+typedef struct {
+    float center_x;
+    float center_y;
+    float zoom;
+    int max_iterations;
+    Uint32 palette[RS_MANDEL_MAX_ITERATIONS + 1];
+} RSMandelView;
+
+typedef struct {
+    Uint32 iterations;
+    Uint32 skipped;     // Samples resolved by the cardioid/bulb test
+} RSMandelStats;
+
+void rs_mandel_view_init(RSMandelView *view,
+                         float center_x,
+                         float center_y,
+                         float zoom,
+                         int max_iterations,
+                         float phase);
+
+/*
+ * Renders the samples of rows [row_start, row_end) that lie on a step x step
+ * lattice at (offset_x, offset_y); each sample fills a fill x fill block.
+ * step 1 / fill 1 is a full frame, step 2 / fill 2 the progressive coarse pass.
+ */
+void rs_mandel_rows(Uint32 *pixels,
+                    int width,
+                    int height,
+                    int row_start,
+                    int row_end,
+                    const RSMandelView *view,
+                    int step,
+                    int offset_x,
+                    int offset_y,
+                    int fill,
+                    RSMandelStats *stats);
+
+/*
+ * One cooling step for rows [row_start, row_end) of a Uint8 fire grid. Cell
+ * (x, y) lives at y * stride + x + 1; the columns either side of each row are
+ * zero padding so the 2x3 neighbourhood needs no bounds checks. Callers must
+ * keep row_end <= height - 1 because row y reads rows y and y + 1 of src.
+ */
+void rs_fire_rows(const Uint8 *src,
+                  Uint8 *dst,
+                  int width,
+                  int stride,
+                  int row_start,
+                  int row_end,
+                  Uint32 seed);
+
+/*
+ * Bit-packed Life on a torus, 32 cells per word (cell x is bit x & 31 of word
+ * x >> 5). Each row holds `words` cells words plus a wrap copy either side:
+ * row[-1] == row[words - 1] and row[words] == row[0]. Pointers address word 0
+ * of row 0, so the left pad sits at index -1. rs_life_rows refreshes the pads
+ * of every row it writes.
+ */
+void rs_life_rows(const Uint32 *src,
+                  Uint32 *dst,
+                  int words,
+                  int stride,
+                  int height,
+                  int row_start,
+                  int row_end);
+
+// Expands `count` cells starting at bit x0 of a packed row into pixels. Live
+// cells get column | diagonal | row colour, dead ones opaque black.
+void rs_life_unpack_row(Uint32 *pixels,
+                        const Uint32 *row,
+                        int x0,
+                        int count,
+                        const Uint32 *column_colour,
+                        const Uint32 *diagonal_colour,
+                        Uint32 row_colour);
+
+#endif /* RENDER_SUITE_SCENES_PIXEL_KERNELS_H */
@@ -1,5 +1,7 @@
 #include "render_suite/scenes/pixels.h"
+#include "render_suite/scenes/pixel_kernels.h"
 #include "render_suite/render_neon.h"
+#include "render_suite/worker_pool.h"
 
 #include <stdlib.h>
 #include <math.h>
@@ -11,19 +13,119 @@
 #define PIXEL_SURFACE_HEIGHT 120
 #define FIRE_HEIGHT 60
 #define FIRE_WIDTH 80
-
-typedef enum {
-    PIXEL_MODE_PLASMA = 0,
-    PIXEL_MODE_FIRE,
-    PIXEL_MODE_MANDELBROT,
-    PIXEL_MODE_CELLULAR,
-    PIXEL_MODE_MAX
-} PixelMode;
+#define FIRE_LARGE_SCALE 4 // Large grid cells per displayed pixel, each axis
+#define FIRE_LARGE_WIDTH (PIXEL_SURFACE_WIDTH * FIRE_LARGE_SCALE)
+#define FIRE_LARGE_HEIGHT (PIXEL_SURFACE_HEIGHT * FIRE_LARGE_SCALE)
+#define FIRE_GRID_STRIDE(width) ((width) + 2) // Zero pad column either side
+#define FIRE_DISTURB_SPAN 5
+#define LIFE_PAN_SPEED 8.0f // Viewport cells per phase unit
+#define LIFE_WORDS(width) ((width) / 32)
+#define LIFE_STRIDE(width) (LIFE_WORDS(width) + 2) // Wrap word either side
+#define LIFE_CHECK_GENERATIONS 16
+
+// From screen-sized (L1-resident) to a 2 MB grid that has to stream from DRAM
+static const int life_grid_sizes[RS_PIXEL_LIFE_GRIDS][2] = {
+    {PIXEL_SURFACE_WIDTH, PIXEL_SURFACE_HEIGHT},
+    {1024, 768},
+    {4096, 4096}
+};
+
+#define PIXEL_BUFFER_COUNT 2
+#define PLASMA_CHECK_PHASES 4
+#define PLASMA_CHECK_MAX_DIFF 16   // Per channel; the reference LUT steps by 2*pi/256
+#define PLASMA_CHECK_MEAN_DIFF 2.5
+#define MANDEL_BASE_ITERATIONS 16
+#define MANDEL_ZOOM_PERIOD 40.0f // Phase units before the zoom wraps back out
+#define MANDEL_PROGRESSIVE_PASSES 4
 
 typedef struct {
     Uint8 r, g, b, a;
 } Pixel32;
 
+// Everything one generation job reads or writes, so bands can run on workers
+typedef struct {
+    RSPixelMode mode;
+    Pixel32 *pixels;
+    int width;
+    int height;
+    float phase;
+    const Uint8 *fire_src;
+    Uint8 *fire_dst;
+    const Uint32 *fire_palette;
+    Uint32 fire_seed;
+    int fire_width;
+    int fire_height;
+    int fire_scale;
+    int fire_x;
+    int fire_y;
+    SDL_bool fire_clear;
+    const Uint32 *life_src;
+    Uint32 *life_dst;
+    int life_words;
+    int life_height;
+    int life_view_x;
+    int life_view_y;
+    const Uint32 *life_column;
+    const Uint32 *life_diagonal;
+    const Uint32 *life_row;
+
+    int rows;
+    int row_unit;
+    const RSMandelView *mandel_view;
+    Uint32 *mandel_target;
+    int mandel_step;
+    int mandel_offset_x;
+    int mandel_offset_y;
+    int mandel_fill;
+    Uint32 mandel_samples;
+    SDL_atomic_t mandel_iterations;
+    SDL_atomic_t mandel_skipped;
+} PixelJob;
+
+// Double-buffered targets: workers fill one buffer while the other uploads
+typedef struct {
+    Pixel32 *buffers[PIXEL_BUFFER_COUNT];
+    int ready;
+    int generating;
+    PixelJob job;
+    int job_threads;
+    Uint32 job_count;
+    Uint64 upload_start;
+    Uint64 upload_end;
+
+    Uint8 *fire[2];           // Sized for the large grid; the small one uses a prefix
+    int fire_current;
+    Uint32 fire_frame;
+    int fire_width;
+    int fire_height;
+    SDL_bool fire_large;
+    SDL_bool fire_cleared[PIXEL_BUFFER_COUNT]; // Border outside the fire is already black
+    Uint32 fire_palette[256];
+
+    Uint32 *life[2];          // Bit-packed grids, row stride LIFE_STRIDE(width)
+    int life_current;
+    int life_grid;
+    int life_width;
+    int life_height;
+    Uint32 life_column[PIXEL_SURFACE_WIDTH];
+    Uint32 life_row[PIXEL_SURFACE_HEIGHT];
+    Uint32 life_diagonal[PIXEL_SURFACE_WIDTH + PIXEL_SURFACE_HEIGHT];
+
+    RSMandelView mandel_view;
+    Uint32 *mandel_progressive;
+    int mandel_pass;
+} PixelPipeline;
+
+static PixelPipeline g_pixel_pipeline = {0};
+static SDL_bool g_pixel_checks_done = SDL_FALSE; // Self-checks run once per process
+
+static const char *pixel_mode_names[RS_PIXEL_MODE_MAX] = {
+    "Plasma",
+    "Fire",
+    "Mandelbrot",
+    "Cellular"
+};
+
 static inline float rs_clampf(float value, float min_val, float max_val)
 {
     if (value < min_val) return min_val;
@@ -38,6 +140,14 @@ static inline int rs_clampi(int value, int min_val, int max_val)
     return value;
 }
 
+static inline Uint32 rs_pixel_pack(Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+    const Pixel32 colour = {r, g, b, a};
+    Uint32 packed;
+    memcpy(&packed, &colour, sizeof(packed));
+    return packed;
+}
+
 static inline Uint8 rs_clamp_u8(int value)
 {
     if (value < 0) return 0;
@@ -69,12 +179,12 @@ static inline float rs_fast_cos(float x)
     return rs_fast_sin(x + RS_PI * 0.5f);
 }
 
-static void rs_generate_plasma(Pixel32 *pixels, int width, int height, float phase)
+static void rs_generate_plasma(Pixel32 *pixels, int width, int row_start, int row_end, float phase)
 {
     const float scale = 0.02f;
     const float time_scale = 0.1f;
 
-    for (int y = 0; y < height; y++) {
+    for (int y = row_start; y < row_end; y++) {
         for (int x = 0; x < width; x++) {
             float fx = (float)x * scale;
             float fy = (float)y * scale;
@@ -100,103 +210,67 @@ static void rs_generate_plasma(Pixel32 *pixels, int width, int height, float pha
     }
 }
 
-static void rs_generate_fire(Pixel32 *pixels, int width, int height, float phase, int *fire_buffer)
+static inline Uint32 rs_xorshift32(Uint32 *state)
 {
-    // Initialize fire buffer if needed
-    static SDL_bool fire_initialized = SDL_FALSE;
-    if (!fire_initialized) {
-        // Set bottom row to hot
-        for (int x = 0; x < FIRE_WIDTH; x++) {
-            fire_buffer[(FIRE_HEIGHT - 1) * FIRE_WIDTH + x] = 255;
-        }
-        fire_initialized = SDL_TRUE;
-    }
-
-    // Update fire simulation
-    for (int y = 0; y < FIRE_HEIGHT - 1; y++) {
-        for (int x = 0; x < FIRE_WIDTH; x++) {
-            int sum = 0;
-            int count = 0;
+    Uint32 x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
 
-            // Sample surrounding pixels
-            for (int dy = 0; dy <= 1; dy++) {
-                for (int dx = -1; dx <= 1; dx++) {
-                    int nx = x + dx;
-                    int ny = y + dy;
-                    if (nx >= 0 && nx < FIRE_WIDTH && ny >= 0 && ny < FIRE_HEIGHT) {
-                        sum += fire_buffer[ny * FIRE_WIDTH + nx];
-                        count++;
-                    }
-                }
+// Each displayed row owns fire_scale grid rows. rs_fire_rows only reads the
+// previous frame's grid, so bands never race each other.
+static void rs_generate_fire(const PixelJob *job, int row_start, int row_end)
+{
+    const int width = job->width;
+    const int scale = job->fire_scale;
+    const int stride = FIRE_GRID_STRIDE(job->fire_width);
+    const int display_width = job->fire_width / scale;
+    const int display_height = job->fire_height / scale;
+    const int right = job->fire_x + display_width;
+
+    for (int py = row_start; py < row_end; py++) {
+        Uint32 *row = (Uint32 *)(job->pixels + (size_t)py * (size_t)width);
+
+        const int fy = py - job->fire_y;
+        if (fy < 0 || fy >= display_height) {
+            if (job->fire_clear) {
+                rs_neon_fill_u32(row, 0, (size_t)width);
             }
+            continue;
+        }
+        if (job->fire_clear) {
+            rs_neon_fill_u32(row, 0, (size_t)job->fire_x);
+            rs_neon_fill_u32(row + right, 0, (size_t)(width - right));
+        }
 
-            // Cool down and add some randomness
-            int average = sum / count;
-            int cooling = 2 + (rand() % 4);
-            int new_value = average - cooling;
-            if (new_value < 0) new_value = 0;
-
-            fire_buffer[y * FIRE_WIDTH + x] = new_value;
-        }
-    }
-
-    // Add disturbance to bottom row
-    int disturbance = (int)(phase * 10.0f) % FIRE_WIDTH;
-    for (int i = 0; i < 5; i++) {
-        int x = (disturbance + i) % FIRE_WIDTH;
-        fire_buffer[(FIRE_HEIGHT - 1) * FIRE_WIDTH + x] = 200 + (rand() % 56);
-    }
-
-    // Convert fire buffer to pixels
-    memset(pixels, 0, width * height * sizeof(Pixel32));
-
-    int start_x = (width - FIRE_WIDTH) / 2;
-    int start_y = (height - FIRE_HEIGHT) / 2;
-
-    for (int y = 0; y < FIRE_HEIGHT; y++) {
-        for (int x = 0; x < FIRE_WIDTH; x++) {
-            int px = start_x + x;
-            int py = start_y + y;
-            if (px >= 0 && px < width && py >= 0 && py < height) {
-                int intensity = fire_buffer[y * FIRE_WIDTH + x];
-
-                // Fire color palette
-                Uint8 r, g, b;
-                if (intensity < 64) {
-                    r = intensity * 4;
-                    g = 0;
-                    b = 0;
-                } else if (intensity < 128) {
-                    r = 255;
-                    g = (intensity - 64) * 4;
-                    b = 0;
-                } else if (intensity < 192) {
-                    r = 255;
-                    g = 255;
-                    b = (intensity - 128) * 4;
-                } else {
-                    r = 255;
-                    g = 255;
-                    b = 255;
-                }
+        // The bottom grid row is seeded serially before the job is queued
+        const int grid_y = fy * scale;
+        const int sim_end = SDL_min(grid_y + scale, job->fire_height - 1);
+        if (grid_y < sim_end) {
+            rs_fire_rows(job->fire_src, job->fire_dst, job->fire_width, stride, grid_y, sim_end, job->fire_seed);
+        }
 
-                pixels[py * width + px].r = r;
-                pixels[py * width + px].g = g;
-                pixels[py * width + px].b = b;
-                pixels[py * width + px].a = 255;
-            }
+        // Show the last row of each block so the seeded row stays visible
+        const Uint8 *cells = job->fire_dst + (size_t)(grid_y + scale - 1) * (size_t)stride + 1;
+        Uint32 *out = row + job->fire_x;
+        for (int x = 0; x < display_width; x++) {
+            out[x] = job->fire_palette[cells[x * scale]];
         }
     }
 }
 
-static void rs_generate_mandelbrot(Pixel32 *pixels, int width, int height, float phase)
+static void rs_generate_mandelbrot(Pixel32 *pixels, int width, int height,
+                                   int row_start, int row_end, float phase)
 {
     const float zoom = 1.0f + phase * 0.05f;
     const float center_x = -0.5f + rs_fast_cos(phase * 0.3f) * 0.2f;
     const float center_y = 0.0f + rs_fast_sin(phase * 0.2f) * 0.2f;
     const int max_iterations = 16; // Reduced from 32
 
-    for (int y = 0; y < height; y++) {
+    for (int y = row_start; y < row_end; y++) {
         for (int x = 0; x < width; x++) {
             float real = center_x + ((float)x / (float)width - 0.5f) * 4.0f / zoom;
             float imag = center_y + ((float)y / (float)height - 0.5f) * 4.0f / zoom;
@@ -247,24 +321,9 @@ static void rs_generate_mandelbrot(Pixel32 *pixels, int width, int height, float
     }
 }
 
-static void rs_generate_cellular(Pixel32 *pixels, int width, int height, float phase)
+// Byte-per-cell reference for the packed engine's start-up check
+static void rs_life_reference_step(const Uint8 *cells, Uint8 *new_cells, int width, int height)
 {
-    static Uint8 *cells = NULL;
-    static Uint8 *new_cells = NULL;
-    static SDL_bool initialized = SDL_FALSE;
-
-    if (!initialized) {
-        cells = malloc(width * height);
-        new_cells = malloc(width * height);
-
-        // Initialize with random cells
-        for (int i = 0; i < width * height; i++) {
-            cells[i] = (rand() % 100) < 30 ? 1 : 0;
-        }
-        initialized = SDL_TRUE;
-    }
-
-    // Conway's Game of Life rules with modifications
     for (int y = 0; y < height; y++) {
         for (int x = 0; x < width; x++) {
             int neighbors = 0;
@@ -281,8 +340,6 @@ static void rs_generate_cellular(Pixel32 *pixels, int width, int height, float p
             }
 
             int current = cells[y * width + x];
-
-            // Modified rules for more dynamic behavior
             if (current) {
                 new_cells[y * width + x] = (neighbors == 2 || neighbors == 3) ? 1 : 0;
             } else {
@@ -290,38 +347,536 @@ static void rs_generate_cellular(Pixel32 *pixels, int width, int height, float p
             }
         }
     }
+}
+
+// Steps the band's grid rows, then unpacks whichever of them the viewport shows
+static void rs_generate_cellular(const PixelJob *job, int row_start, int row_end)
+{
+    const int stride = job->life_words + 2;
+    rs_life_rows(job->life_src, job->life_dst, job->life_words, stride, job->life_height, row_start, row_end);
+
+    const int first = SDL_max(row_start, job->life_view_y);
+    const int last = SDL_min(row_end, job->life_view_y + job->height);
+    for (int y = first; y < last; y++) {
+        const int py = y - job->life_view_y;
+        rs_life_unpack_row((Uint32 *)(job->pixels + (size_t)py * (size_t)job->width),
+                           job->life_dst + (size_t)y * (size_t)stride,
+                           job->life_view_x,
+                           job->width,
+                           job->life_column,
+                           job->life_diagonal + py,
+                           job->life_row[py]);
+    }
+}
 
-    // Add some randomness based on phase
-    if ((int)(phase * 10.0f) % 60 == 0) {
-        for (int i = 0; i < 10; i++) {
-            int x = rand() % width;
-            int y = rand() % height;
-            new_cells[y * width + x] = 1;
+// Progressive passes own whole 2-row blocks (row_unit 2) so a coarse sample's
+// 2x2 fill never lands in a band that is concurrently copying it out.
+static void rs_generate_mandelbrot_band(PixelJob *job, int row_start, int row_end)
+{
+    const int y0 = row_start * job->row_unit;
+    const int y1 = SDL_min(row_end * job->row_unit, job->height);
+    RSMandelStats stats = {0, 0};
+
+    rs_mandel_rows(job->mandel_target, job->width, job->height, y0, y1,
+                   job->mandel_view,
+                   job->mandel_step,
+                   job->mandel_offset_x,
+                   job->mandel_offset_y,
+                   job->mandel_fill,
+                   &stats);
+
+    if (job->mandel_target != (Uint32 *)job->pixels) {
+        for (int y = y0; y < y1; y++) {
+            const size_t offset = (size_t)y * (size_t)job->width;
+            rs_neon_copy_u32((uint32_t *)(job->pixels + offset), job->mandel_target + offset, (size_t)job->width);
         }
     }
 
-    // Swap buffers
-    Uint8 *temp = cells;
-    cells = new_cells;
-    new_cells = temp;
+    SDL_AtomicAdd(&job->mandel_iterations, (int)stats.iterations);
+    SDL_AtomicAdd(&job->mandel_skipped, (int)stats.skipped);
+}
+
+static void rs_pixels_generate_band(void *userdata, int row_start, int row_end)
+{
+    PixelJob *job = (PixelJob *)userdata;
+
+    switch (job->mode) {
+        case RS_PIXEL_MODE_PLASMA:
+#if RS_HAS_NEON
+            rs_plasma_rows((Uint32 *)job->pixels, job->width, row_start, row_end, job->phase);
+#else
+            // Without SIMD the table lookups beat six scalar polynomial sines
+            rs_generate_plasma(job->pixels, job->width, row_start, row_end, job->phase);
+#endif
+            break;
+        case RS_PIXEL_MODE_FIRE:
+            rs_generate_fire(job, row_start, row_end);
+            break;
+        case RS_PIXEL_MODE_MANDELBROT:
+            rs_generate_mandelbrot_band(job, row_start, row_end);
+            break;
+        case RS_PIXEL_MODE_CELLULAR:
+            rs_generate_cellular(job, row_start, row_end);
+            break;
+        default:
+            break;
+    }
+}
 
-    // Convert to pixels with color based on phase
-    float color_phase = phase * 0.5f;
+// Clears both grids and re-seeds a hot bottom row for the requested size
+static void rs_pixels_fire_reset(PixelPipeline *pipeline, SDL_bool large)
+{
+    const int width = large ? FIRE_LARGE_WIDTH : FIRE_WIDTH;
+    const int height = large ? FIRE_LARGE_HEIGHT : FIRE_HEIGHT;
+    const size_t stride = (size_t)FIRE_GRID_STRIDE(width);
+
+    for (int i = 0; i < 2; i++) {
+        SDL_memset(pipeline->fire[i], 0, stride * (size_t)height);
+        SDL_memset(pipeline->fire[i] + (size_t)(height - 1) * stride + 1, 255, (size_t)width);
+    }
+
+    pipeline->fire_width = width;
+    pipeline->fire_height = height;
+    pipeline->fire_large = large;
+    pipeline->fire_current = 0;
+    for (int i = 0; i < PIXEL_BUFFER_COUNT; i++) {
+        pipeline->fire_cleared[i] = SDL_FALSE;
+    }
+}
+
+// Same ramp the per-pixel branches used to compute, looked up by intensity
+static void rs_pixels_fire_palette(Uint32 *palette)
+{
+    for (int intensity = 0; intensity < 256; intensity++) {
+        if (intensity < 64) {
+            palette[intensity] = rs_pixel_pack((Uint8)(intensity * 4), 0, 0, 255);
+        } else if (intensity < 128) {
+            palette[intensity] = rs_pixel_pack(255, (Uint8)((intensity - 64) * 4), 0, 255);
+        } else if (intensity < 192) {
+            palette[intensity] = rs_pixel_pack(255, 255, (Uint8)((intensity - 128) * 4), 255);
+        } else {
+            palette[intensity] = rs_pixel_pack(255, 255, 255, 255);
+        }
+    }
+}
+
+// (Re)allocates both grids for the requested size and seeds about a quarter
+// of the cells. On failure life[] stays NULL and the effect falls back.
+static void rs_pixels_life_reset(PixelPipeline *pipeline, int grid)
+{
+    const int width = life_grid_sizes[grid][0];
+    const int height = life_grid_sizes[grid][1];
+    const int words = LIFE_WORDS(width);
+    const size_t stride = (size_t)LIFE_STRIDE(width);
+
+    free(pipeline->life[0]);
+    free(pipeline->life[1]);
+    pipeline->life[0] = calloc(stride * (size_t)height, sizeof(Uint32));
+    pipeline->life[1] = calloc(stride * (size_t)height, sizeof(Uint32));
+    pipeline->life_grid = grid;
+    pipeline->life_width = width;
+    pipeline->life_height = height;
+    pipeline->life_current = 0;
+    if (!pipeline->life[0] || !pipeline->life[1]) {
+        free(pipeline->life[0]);
+        free(pipeline->life[1]);
+        pipeline->life[0] = NULL;
+        pipeline->life[1] = NULL;
+        return;
+    }
+
+    Uint32 rng = (Uint32)rand() | 1u;
     for (int y = 0; y < height; y++) {
-        for (int x = 0; x < width; x++) {
-            if (cells[y * width + x]) {
-                float fx = (float)x / (float)width;
-                float fy = (float)y / (float)height;
+        Uint32 *row = pipeline->life[0] + (size_t)y * stride + 1;
+        for (int i = 0; i < words; i++) {
+            row[i] = rs_xorshift32(&rng) & rs_xorshift32(&rng);
+        }
+        row[-1] = row[words - 1];
+        row[words] = row[0];
+    }
+}
 
-                pixels[y * width + x].r = rs_clamp_u8((int)((rs_fast_sin(color_phase + fx) + 1.0f) * 127.5f));
-                pixels[y * width + x].g = rs_clamp_u8((int)((rs_fast_sin(color_phase + fy + 2.0f) + 1.0f) * 127.5f));
-                pixels[y * width + x].b = rs_clamp_u8((int)((rs_fast_sin(color_phase + fx + fy + 4.0f) + 1.0f) * 127.5f));
-                pixels[y * width + x].a = 255;
-            } else {
-                pixels[y * width + x] = (Pixel32){0, 0, 0, 255};
+// Triangle wave over [0, range] so the viewport pans back and forth
+static int rs_pixels_life_pan(float t, int range)
+{
+    if (range <= 0) {
+        return 0;
+    }
+    const int period = range * 2;
+    const int position = (int)SDL_fabs(t) % period;
+    return position <= range ? position : period - position;
+}
+
+// Live-cell colours keep the old per-pixel look as separable tables: red by
+// column, green by row and blue along the diagonal.
+static void rs_pixels_life_colours(PixelPipeline *pipeline, float phase)
+{
+    const float color_phase = phase * 0.5f;
+    for (int x = 0; x < PIXEL_SURFACE_WIDTH; x++) {
+        const float fx = (float)x / (float)PIXEL_SURFACE_WIDTH;
+        pipeline->life_column[x] =
+            rs_pixel_pack(rs_clamp_u8((int)((rs_fast_sin(color_phase + fx) + 1.0f) * 127.5f)), 0, 0, 0);
+    }
+    for (int y = 0; y < PIXEL_SURFACE_HEIGHT; y++) {
+        const float fy = (float)y / (float)PIXEL_SURFACE_HEIGHT;
+        pipeline->life_row[y] =
+            rs_pixel_pack(0, rs_clamp_u8((int)((rs_fast_sin(color_phase + fy + 2.0f) + 1.0f) * 127.5f)), 0, 255);
+    }
+    for (int d = 0; d < PIXEL_SURFACE_WIDTH + PIXEL_SURFACE_HEIGHT; d++) {
+        const float fd = (float)d / (float)PIXEL_SURFACE_WIDTH;
+        pipeline->life_diagonal[d] =
+            rs_pixel_pack(0, 0, rs_clamp_u8((int)((rs_fast_sin(color_phase + fd + 4.0f) + 1.0f) * 127.5f)), 0);
+    }
+}
+
+// Centre path matches rs_generate_mandelbrot; zoom is passed in because the
+// scene wraps it while the self-check uses the reference's unbounded zoom.
+static void rs_pixels_mandel_view(RSMandelView *view, float phase, float zoom, int max_iterations)
+{
+    const float center_x = -0.5f + rs_fast_cos(phase * 0.3f) * 0.2f;
+    const float center_y = 0.0f + rs_fast_sin(phase * 0.2f) * 0.2f;
+    rs_mandel_view_init(view, center_x, center_y, zoom, max_iterations, phase);
+}
+
+static void rs_pixels_prepare_mandelbrot(const RenderSuiteState *state, PixelPipeline *pipeline, float phase)
+{
+    static const int pass_offsets[MANDEL_PROGRESSIVE_PASSES][2] = {{0, 0}, {1, 0}, {0, 1}, {1, 1}};
+    PixelJob *job = &pipeline->job;
+    const int max_iterations = SDL_min(MANDEL_BASE_ITERATIONS * SDL_max(state->stress_level, 1),
+                                       RS_MANDEL_MAX_ITERATIONS);
+    const SDL_bool progressive =
+        (state->pixel_option[RS_PIXEL_MODE_MANDELBROT] && pipeline->mandel_progressive) ? SDL_TRUE : SDL_FALSE;
+
+    // Deep zooms end up entirely inside the cardioid, which costs nothing
+    const float zoom = 1.0f + fmodf(phase, MANDEL_ZOOM_PERIOD) * 0.05f;
+
+    if (!progressive) {
+        rs_pixels_mandel_view(&pipeline->mandel_view, phase, zoom, max_iterations);
+        pipeline->mandel_pass = 0;
+        job->mandel_target = (Uint32 *)job->pixels;
+        job->mandel_step = 1;
+        job->mandel_offset_x = 0;
+        job->mandel_offset_y = 0;
+        job->mandel_fill = 1;
+        job->row_unit = 1;
+    } else {
+        // The view is frozen until all four passes have landed
+        const int pass = pipeline->mandel_pass;
+        if (pass == 0) {
+            rs_pixels_mandel_view(&pipeline->mandel_view, phase, zoom, max_iterations);
+        }
+        job->mandel_target = pipeline->mandel_progressive;
+        job->mandel_step = 2;
+        job->mandel_offset_x = pass_offsets[pass][0];
+        job->mandel_offset_y = pass_offsets[pass][1];
+        job->mandel_fill = (pass == 0) ? 2 : 1;
+        job->row_unit = 2;
+        pipeline->mandel_pass = (pass + 1) % MANDEL_PROGRESSIVE_PASSES;
+    }
+
+    job->mandel_view = &pipeline->mandel_view;
+    job->rows = (job->height + job->row_unit - 1) / job->row_unit;
+    job->mandel_samples =
+        (Uint32)(((job->width - job->mandel_offset_x + job->mandel_step - 1) / job->mandel_step) *
+                 ((job->height - job->mandel_offset_y + job->mandel_step - 1) / job->mandel_step));
+    SDL_AtomicSet(&job->mandel_iterations, 0);
+    SDL_AtomicSet(&job->mandel_skipped, 0);
+}
+
+// Serial part of a frame: swap simulation buffers and apply the random
+// disturbances, which use rand() and must stay on the render thread.
+static void rs_pixels_prepare_job(const RenderSuiteState *state,
+                                  PixelPipeline *pipeline,
+                                  RSPixelMode mode,
+                                  int target,
+                                  float phase)
+{
+    PixelJob *job = &pipeline->job;
+    job->mode = mode;
+    job->pixels = pipeline->buffers[target];
+    job->width = PIXEL_SURFACE_WIDTH;
+    job->height = PIXEL_SURFACE_HEIGHT;
+    job->phase = phase;
+    job->rows = PIXEL_SURFACE_HEIGHT;
+    job->row_unit = 1;
+    if (mode != RS_PIXEL_MODE_FIRE) {
+        pipeline->fire_cleared[target] = SDL_FALSE;
+    }
+
+    if (mode == RS_PIXEL_MODE_MANDELBROT) {
+        rs_pixels_prepare_mandelbrot(state, pipeline, phase);
+    } else if (mode == RS_PIXEL_MODE_FIRE && pipeline->fire[0] && pipeline->fire[1]) {
+        const SDL_bool large = state->pixel_option[RS_PIXEL_MODE_FIRE] ? SDL_TRUE : SDL_FALSE;
+        if (large != pipeline->fire_large) {
+            rs_pixels_fire_reset(pipeline, large);
+        }
+
+        const int fire_width = pipeline->fire_width;
+        const int fire_height = pipeline->fire_height;
+        const size_t stride = (size_t)FIRE_GRID_STRIDE(fire_width);
+        const int src = pipeline->fire_current;
+        const int dst = src ^ 1;
+        Uint8 *bottom = pipeline->fire[dst] + (size_t)(fire_height - 1) * stride + 1;
+        memcpy(bottom, pipeline->fire[src] + (size_t)(fire_height - 1) * stride + 1, (size_t)fire_width);
+
+        // Add disturbance to bottom row, scaled with the grid width
+        const int span = FIRE_DISTURB_SPAN * (fire_width / FIRE_WIDTH);
+        int disturbance = (int)(phase * 10.0f * (float)(fire_width / FIRE_WIDTH)) % fire_width;
+        for (int i = 0; i < span; i++) {
+            int x = (disturbance + i) % fire_width;
+            bottom[x] = (Uint8)(200 + (rand() % 56));
+        }
+
+        job->fire_src = pipeline->fire[src];
+        job->fire_dst = pipeline->fire[dst];
+        job->fire_palette = pipeline->fire_palette;
+        job->fire_seed = (Uint32)rand() ^ (++pipeline->fire_frame * 0x85EBCA6Bu);
+        job->fire_width = fire_width;
+        job->fire_height = fire_height;
+        job->fire_scale = large ? FIRE_LARGE_SCALE : 1;
+        job->fire_x = (job->width - fire_width / job->fire_scale) / 2;
+        job->fire_y = (job->height - fire_height / job->fire_scale) / 2;
+        job->fire_clear = !pipeline->fire_cleared[target];
+        pipeline->fire_cleared[target] = SDL_TRUE;
+        pipeline->fire_current = dst;
+    } else if (mode == RS_PIXEL_MODE_CELLULAR) {
+        const int grid = SDL_clamp(state->pixel_option[RS_PIXEL_MODE_CELLULAR], 0, RS_PIXEL_LIFE_GRIDS - 1);
+        if (grid != pipeline->life_grid) {
+            rs_pixels_life_reset(pipeline, grid);
+        }
+        if (!pipeline->life[0]) {
+            // Grid allocation failed
+            job->mode = RS_PIXEL_MODE_PLASMA;
+            return;
+        }
+
+        const int words = LIFE_WORDS(pipeline->life_width);
+        const size_t stride = (size_t)LIFE_STRIDE(pipeline->life_width);
+        const int src = pipeline->life_current;
+        const int view_x = rs_pixels_life_pan(phase * LIFE_PAN_SPEED, pipeline->life_width - job->width);
+        const int view_y = rs_pixels_life_pan(phase * LIFE_PAN_SPEED * 0.75f, pipeline->life_height - job->height);
+
+        // Add some randomness based on phase, inside the viewport so it shows
+        if ((int)(phase * 10.0f) % 60 == 0) {
+            for (int i = 0; i < 10; i++) {
+                int x = view_x + rand() % PIXEL_SURFACE_WIDTH;
+                int y = view_y + rand() % PIXEL_SURFACE_HEIGHT;
+                Uint32 *row = pipeline->life[src] + (size_t)y * stride + 1;
+                row[x >> 5] |= 1u << (x & 31);
+                row[-1] = row[words - 1];
+                row[words] = row[0];
+            }
+        }
+
+        rs_pixels_life_colours(pipeline, phase);
+        job->life_src = pipeline->life[src] + 1;
+        job->life_dst = pipeline->life[src ^ 1] + 1;
+        job->life_words = words;
+        job->life_height = pipeline->life_height;
+        job->life_view_x = view_x;
+        job->life_view_y = view_y;
+        job->life_column = pipeline->life_column;
+        job->life_diagonal = pipeline->life_diagonal;
+        job->life_row = pipeline->life_row;
+        job->rows = pipeline->life_height;
+        pipeline->life_current = src ^ 1;
+    } else if (mode == RS_PIXEL_MODE_FIRE) {
+        // Simulation buffers failed to allocate
+        job->mode = RS_PIXEL_MODE_PLASMA;
+    }
+}
+
+// Collects the in-flight job and credits the part of the last upload that
+// ran while the workers were still generating.
+static void rs_pixels_collect(RenderSuiteState *state, PixelPipeline *pipeline)
+{
+    if (pipeline->generating < 0) {
+        return;
+    }
+
+    Uint64 submit_counter = 0;
+    Uint64 finish_counter = 0;
+    const double generate_ms = rs_worker_pool_wait(&submit_counter, &finish_counter);
+
+    const int mode = pipeline->job.mode;
+    const int slot = SDL_clamp(pipeline->job_threads, 1, RS_PIXEL_THREADS_MAX) - 1;
+    state->pixel_generate_ms[mode][slot] += generate_ms;
+    state->pixel_generate_runs[mode][slot]++;
+
+    if (mode == RS_PIXEL_MODE_FIRE) {
+        if (state->pixel_fire_width != pipeline->job.fire_width) {
+            // Grid size changed: cell rates from the two sizes don't mix
+            state->pixel_fire_ms = 0.0;
+            state->pixel_fire_cells = 0;
+        }
+        state->pixel_fire_ms += generate_ms;
+        state->pixel_fire_cells += (Uint64)pipeline->job.fire_width * (Uint64)(pipeline->job.fire_height - 1);
+        state->pixel_fire_width = pipeline->job.fire_width;
+        state->pixel_fire_height = pipeline->job.fire_height;
+    } else if (mode == RS_PIXEL_MODE_CELLULAR) {
+        const int life_width = pipeline->job.life_words * 32;
+        if (state->pixel_life_width != life_width) {
+            state->pixel_life_ms = 0.0;
+            state->pixel_life_cells = 0;
+        }
+        state->pixel_life_ms += generate_ms;
+        state->pixel_life_cells += (Uint64)life_width * (Uint64)pipeline->job.life_height;
+        state->pixel_life_width = life_width;
+        state->pixel_life_height = pipeline->job.life_height;
+    } else if (mode == RS_PIXEL_MODE_MANDELBROT) {
+        state->pixel_mandel_ms += generate_ms;
+        state->pixel_mandel_samples += pipeline->job.mandel_samples;
+        state->pixel_mandel_iterations += (Uint32)SDL_AtomicGet(&pipeline->job.mandel_iterations);
+        state->pixel_mandel_skipped += (Uint32)SDL_AtomicGet(&pipeline->job.mandel_skipped);
+        state->pixel_mandel_max_iterations = pipeline->mandel_view.max_iterations;
+        state->pixel_mandel_pass = pipeline->mandel_pass;
+    }
+
+    if (pipeline->upload_end > pipeline->upload_start) {
+        const Uint64 overlap_start = SDL_max(pipeline->upload_start, submit_counter);
+        const Uint64 overlap_end = SDL_min(pipeline->upload_end, finish_counter);
+        if (overlap_end > overlap_start) {
+            state->pixel_overlap_ms +=
+                (double)(overlap_end - overlap_start) / (double)SDL_GetPerformanceFrequency() * 1000.0;
+        }
+    }
+    pipeline->upload_start = 0;
+    pipeline->upload_end = 0;
+
+    pipeline->ready = pipeline->generating;
+    pipeline->generating = -1;
+}
+
+// Compares the SIMD plasma kernel against rs_generate_plasma, which stays as
+// the reference, and times both on the render thread.
+static void rs_pixels_check_plasma(RenderSuiteState *state, Pixel32 *reference, Pixel32 *candidate)
+{
+    const int width = PIXEL_SURFACE_WIDTH;
+    const int height = PIXEL_SURFACE_HEIGHT;
+    const size_t pixel_count = (size_t)width * (size_t)height;
+    Uint64 reference_ticks = 0;
+    Uint64 candidate_ticks = 0;
+    Uint64 diff_total = 0;
+    int max_diff = 0;
+
+    for (int i = 0; i < PLASMA_CHECK_PHASES; i++) {
+        const float phase = (float)i * 37.3f;
+
+        Uint64 start_time = SDL_GetPerformanceCounter();
+        rs_generate_plasma(reference, width, 0, height, phase);
+        Uint64 mid_time = SDL_GetPerformanceCounter();
+        rs_plasma_rows((Uint32 *)candidate, width, 0, height, phase);
+        Uint64 end_time = SDL_GetPerformanceCounter();
+        reference_ticks += mid_time - start_time;
+        candidate_ticks += end_time - mid_time;
+
+        for (size_t p = 0; p < pixel_count; p++) {
+            const int dr = abs((int)reference[p].r - (int)candidate[p].r);
+            const int dg = abs((int)reference[p].g - (int)candidate[p].g);
+            const int db = abs((int)reference[p].b - (int)candidate[p].b);
+            max_diff = SDL_max(max_diff, SDL_max(dr, SDL_max(dg, db)));
+            diff_total += (Uint64)(dr + dg + db);
+        }
+    }
+
+    const double freq = (double)SDL_GetPerformanceFrequency();
+    const double megapixels = (double)pixel_count * PLASMA_CHECK_PHASES / 1000000.0;
+    const double mean_diff = (double)diff_total / ((double)pixel_count * PLASMA_CHECK_PHASES * 3.0);
+
+    state->pixel_plasma_ref_mps = reference_ticks ? megapixels / ((double)reference_ticks / freq) : 0.0;
+    state->pixel_plasma_simd_mps = candidate_ticks ? megapixels / ((double)candidate_ticks / freq) : 0.0;
+    state->pixel_plasma_max_diff = max_diff;
+    state->pixel_plasma_check_ok =
+        (max_diff <= PLASMA_CHECK_MAX_DIFF && mean_diff <= PLASMA_CHECK_MEAN_DIFF) ? SDL_TRUE : SDL_FALSE;
+
+    SDL_Log("Plasma check %s: max diff %d, mean %.2f | reference %.2f MP/s, SIMD %.2f MP/s",
+            state->pixel_plasma_check_ok ? "passed" : "FAILED",
+            max_diff,
+            mean_diff,
+            state->pixel_plasma_ref_mps,
+            state->pixel_plasma_simd_mps);
+}
+
+// The lane-refill kernel must reproduce the reference escape counts exactly
+static int rs_pixels_check_mandelbrot(Pixel32 *reference, Pixel32 *candidate)
+{
+    const int width = PIXEL_SURFACE_WIDTH;
+    const int height = PIXEL_SURFACE_HEIGHT;
+    const float phase = 3.7f;
+    RSMandelView view;
+    RSMandelStats stats = {0, 0};
+
+    rs_pixels_mandel_view(&view, phase, 1.0f + phase * 0.05f, MANDEL_BASE_ITERATIONS);
+    rs_generate_mandelbrot(reference, width, height, 0, height, phase);
+    rs_mandel_rows((Uint32 *)candidate, width, height, 0, height, &view, 1, 0, 0, 1, &stats);
+
+    int mismatches = 0;
+    for (int i = 0; i < width * height; i++) {
+        if (memcmp(&reference[i], &candidate[i], sizeof(Pixel32)) != 0) {
+            mismatches++;
+        }
+    }
+
+    SDL_Log("Mandelbrot check %s: %d mismatched pixels, %u iterations, %u interior skips",
+            mismatches == 0 ? "passed" : "FAILED",
+            mismatches,
+            stats.iterations,
+            stats.skipped);
+    return mismatches;
+}
+
+// Steps a random screen-sized grid with both engines and compares every cell.
+// Returns -1 when the grids could not be allocated.
+static int rs_pixels_check_life(void)
+{
+    const int width = PIXEL_SURFACE_WIDTH;
+    const int height = PIXEL_SURFACE_HEIGHT;
+    const int words = LIFE_WORDS(width);
+    const int stride = LIFE_STRIDE(width);
+    Uint8 *cells[2] = {malloc((size_t)width * height), malloc((size_t)width * height)};
+    Uint32 *packed[2] = {calloc((size_t)stride * height, sizeof(Uint32)),
+                         calloc((size_t)stride * height, sizeof(Uint32))};
+    int mismatches = -1;
+
+    if (cells[0] && cells[1] && packed[0] && packed[1]) {
+        for (int y = 0; y < height; y++) {
+            Uint32 *row = packed[0] + (size_t)y * stride + 1;
+            for (int x = 0; x < width; x++) {
+                cells[0][y * width + x] = (rand() % 100) < 30 ? 1 : 0;
+                row[x >> 5] |= (Uint32)cells[0][y * width + x] << (x & 31);
             }
+            row[-1] = row[words - 1];
+            row[words] = row[0];
+        }
+
+        int current = 0;
+        for (int generation = 0; generation < LIFE_CHECK_GENERATIONS; generation++) {
+            rs_life_reference_step(cells[current], cells[current ^ 1], width, height);
+            rs_life_rows(packed[current] + 1, packed[current ^ 1] + 1, words, stride, height, 0, height);
+            current ^= 1;
         }
+
+        mismatches = 0;
+        for (int y = 0; y < height; y++) {
+            const Uint32 *row = packed[current] + (size_t)y * stride + 1;
+            for (int x = 0; x < width; x++) {
+                if ((int)((row[x >> 5] >> (x & 31)) & 1u) != cells[current][y * width + x]) {
+                    mismatches++;
+                }
+            }
+        }
+
+        SDL_Log("Life check %s: %d mismatched cells after %d generations",
+                mismatches == 0 ? "passed" : "FAILED",
+                mismatches,
+                LIFE_CHECK_GENERATIONS);
     }
+
+    free(cells[0]);
+    free(cells[1]);
+    free(packed[0]);
+    free(packed[1]);
+    return mismatches;
 }
 
 void rs_scene_pixels_init(RenderSuiteState *state, SDL_Renderer *renderer)
@@ -340,7 +895,8 @@ void rs_scene_pixels_init(RenderSuiteState *state, SDL_Renderer *renderer)
                                                0x000000FF,
                                                0xFF000000);
 
-    state->pixel_buffer = malloc(PIXEL_SURFACE_WIDTH * PIXEL_SURFACE_HEIGHT * sizeof(Pixel32));
+    const size_t pixel_count = (size_t)PIXEL_SURFACE_WIDTH * (size_t)PIXEL_SURFACE_HEIGHT;
+    state->pixel_buffer = calloc(pixel_count * PIXEL_BUFFER_COUNT, sizeof(Pixel32));
 
     if (renderer) {
         state->pixel_texture = SDL_CreateTexture(renderer,
@@ -350,14 +906,88 @@ void rs_scene_pixels_init(RenderSuiteState *state, SDL_Renderer *renderer)
                                                 PIXEL_SURFACE_HEIGHT);
     }
 
+    PixelPipeline *pipeline = &g_pixel_pipeline;
+    SDL_memset(pipeline, 0, sizeof(*pipeline));
+    pipeline->ready = -1;
+    pipeline->generating = -1;
+    if (state->pixel_buffer) {
+        for (int i = 0; i < PIXEL_BUFFER_COUNT; i++) {
+            pipeline->buffers[i] = (Pixel32 *)state->pixel_buffer + pixel_count * (size_t)i;
+        }
+    }
+
+    // Both grids are sized for the large option so toggling never reallocates
+    const size_t fire_bytes = (size_t)FIRE_GRID_STRIDE(FIRE_LARGE_WIDTH) * FIRE_LARGE_HEIGHT;
+    pipeline->fire[0] = malloc(fire_bytes);
+    pipeline->fire[1] = malloc(fire_bytes);
+    if (pipeline->fire[0] && pipeline->fire[1]) {
+        rs_pixels_fire_reset(pipeline, SDL_FALSE);
+    }
+    rs_pixels_fire_palette(pipeline->fire_palette);
+
+    rs_pixels_life_reset(pipeline, 0);
+
+    // The checks run on fixed inputs, so re-entering the scene reuses the
+    // results kept in state instead of stalling on them again
+    if (!g_pixel_checks_done && pipeline->buffers[0] && pipeline->buffers[1]) {
+        rs_pixels_check_plasma(state, pipeline->buffers[0], pipeline->buffers[1]);
+        state->pixel_mandel_check_mismatches = rs_pixels_check_mandelbrot(pipeline->buffers[0],
+                                                                          pipeline->buffers[1]);
+        state->pixel_life_check_mismatches = rs_pixels_check_life();
+        g_pixel_checks_done = SDL_TRUE;
+    }
+
+    pipeline->mandel_progressive = calloc(pixel_count, sizeof(Uint32));
+
+    // Two workers match the dual-core target; the render thread only uploads
+    rs_worker_pool_init(SDL_clamp(SDL_GetCPUCount(), 1, RS_PIXEL_THREADS_MAX));
+
     state->pixel_phase = 0.0f;
     state->pixel_plasma_offset = 0;
 }
 
+void rs_scene_pixels_report(const RenderSuiteState *state)
+{
+    if (!state) return;
+
+    if (g_pixel_checks_done) {
+        SDL_Log("Pixel self-checks: plasma %s (max diff %d) | mandelbrot %d mismatches | life %d mismatches",
+                state->pixel_plasma_check_ok ? "passed" : "FAILED",
+                state->pixel_plasma_max_diff,
+                state->pixel_mandel_check_mismatches,
+                state->pixel_life_check_mismatches);
+    }
+    for (int mode = 0; mode < RS_PIXEL_MODE_MAX; mode++) {
+        const Uint64 single_runs = state->pixel_generate_runs[mode][0];
+        const Uint64 dual_runs = state->pixel_generate_runs[mode][1];
+        if (single_runs == 0) {
+            continue;
+        }
+        const double single_ms = state->pixel_generate_ms[mode][0] / (double)single_runs;
+        if (dual_runs == 0) {
+            SDL_Log("Pixel %s: 1 thread %.3fms | 2 threads n/a", pixel_mode_names[mode], single_ms);
+            continue;
+        }
+        const double dual_ms = state->pixel_generate_ms[mode][1] / (double)dual_runs;
+        SDL_Log("Pixel %s: 1 thread %.3fms | 2 threads %.3fms | speedup x%.2f",
+                pixel_mode_names[mode], single_ms, dual_ms, dual_ms > 0.0 ? single_ms / dual_ms : 0.0);
+    }
+}
+
 void rs_scene_pixels_cleanup(RenderSuiteState *state)
 {
     if (!state) return;
 
+    rs_worker_pool_shutdown();
+
+    PixelPipeline *pipeline = &g_pixel_pipeline;
+    free(pipeline->life[0]);
+    free(pipeline->life[1]);
+    free(pipeline->mandel_progressive);
+    free(pipeline->fire[0]);
+    free(pipeline->fire[1]);
+    SDL_memset(pipeline, 0, sizeof(*pipeline));
+
     if (state->pixel_surface) {
         SDL_FreeSurface(state->pixel_surface);
         state->pixel_surface = NULL;
@@ -379,6 +1009,7 @@ void rs_scene_pixels(RenderSuiteState *state,
                      BenchMetrics *metrics,
                      double delta_seconds)
 {
+    PixelPipeline *pipeline = &g_pixel_pipeline;
     if (!state || !renderer || !state->pixel_buffer) {
         return;
     }
@@ -391,38 +1022,41 @@ void rs_scene_pixels(RenderSuiteState *state,
 
     // Cycle through different pixel modes
     const int mode_duration = 300; // frames per mode
-    const int current_mode = ((int)(state->pixel_phase * 60.0f) / mode_duration) % PIXEL_MODE_MAX;
+    const int current_mode = ((int)(state->pixel_phase * 60.0f) / mode_duration) % RS_PIXEL_MODE_MAX;
+    state->pixel_mode = current_mode;
 
     // Number of operations per frame based on stress level
     const int operations_per_frame = rs_clampi((int)(1 + factor * 2), 1, 3);
 
     for (int op = 0; op < operations_per_frame; op++) {
-        Uint64 start_time = SDL_GetPerformanceCounter();
-
-        Pixel32 *pixels = (Pixel32 *)state->pixel_buffer;
-        if (!pixels) {
-            continue;
-        }
+        float op_phase = state->pixel_phase + (float)op * 0.1f;
 
-        static int fire_buffer[FIRE_HEIGHT * FIRE_WIDTH] = {0};
+        // Frame N finished generating on the workers; queue frame N+1 into the
+        // other buffer before uploading N so the two overlap.
+        rs_pixels_collect(state, pipeline);
 
-        float op_phase = state->pixel_phase + (float)op * 0.1f;
+        const int target = (pipeline->ready == 0) ? 1 : 0;
+        int threads = state->pixel_threads;
+        if (threads <= 0) {
+            threads = 1 + (int)(pipeline->job_count & 1u);
+        }
+        // The pool may have fewer workers than asked for (single core, or a
+        // thread that failed to start), so file the stats under what actually ran
+        const int available = SDL_max(rs_worker_pool_thread_count(), 1);
+        pipeline->job_threads = SDL_clamp(threads, 1, SDL_min(available, RS_PIXEL_THREADS_MAX));
+        pipeline->job_count++;
+        rs_pixels_prepare_job(state, pipeline, (RSPixelMode)current_mode, target, op_phase);
+        if (rs_worker_pool_submit(rs_pixels_generate_band, &pipeline->job,
+                                  pipeline->job.rows, pipeline->job_threads)) {
+            pipeline->generating = target;
+        }
 
-        // Generate different pixel effects
-        switch (current_mode) {
-            case PIXEL_MODE_PLASMA:
-                rs_generate_plasma(pixels, PIXEL_SURFACE_WIDTH, PIXEL_SURFACE_HEIGHT, op_phase);
-                break;
-            case PIXEL_MODE_FIRE:
-                rs_generate_fire(pixels, PIXEL_SURFACE_WIDTH, PIXEL_SURFACE_HEIGHT, op_phase, fire_buffer);
-                break;
-            case PIXEL_MODE_MANDELBROT:
-                rs_generate_mandelbrot(pixels, PIXEL_SURFACE_WIDTH, PIXEL_SURFACE_HEIGHT, op_phase);
-                break;
-            case PIXEL_MODE_CELLULAR:
-                rs_generate_cellular(pixels, PIXEL_SURFACE_WIDTH, PIXEL_SURFACE_HEIGHT, op_phase);
-                break;
+        if (pipeline->ready < 0) {
+            continue;
         }
+        Pixel32 *pixels = pipeline->buffers[pipeline->ready];
+
+        Uint64 start_time = SDL_GetPerformanceCounter();
 
         // Upload to streaming texture using NEON copy path when available
         if (state->pixel_texture) {
@@ -443,9 +1077,13 @@ void rs_scene_pixels(RenderSuiteState *state,
         }
 
         Uint64 end_time = SDL_GetPerformanceCounter();
+        pipeline->upload_start = start_time;
+        pipeline->upload_end = end_time;
+
+        double lock_time = (double)(end_time - start_time) /
+                         (double)SDL_GetPerformanceFrequency() * 1000.0;
+        state->pixel_upload_ms += lock_time;
         if (metrics) {
-            double lock_time = (double)(end_time - start_time) /
-                             (double)SDL_GetPerformanceFrequency() * 1000.0;
             metrics->lock_unlock_overhead_ms += lock_time;
             metrics->pixel_operations++;
         }
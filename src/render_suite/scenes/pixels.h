@@ -14,4 +14,7 @@ void rs_scene_pixels(RenderSuiteState *state,
 void rs_scene_pixels_init(RenderSuiteState *state, SDL_Renderer *renderer);
 void rs_scene_pixels_cleanup(RenderSuiteState *state);
 
+// Logs single vs dual thread generation times per mode
+void rs_scene_pixels_report(const RenderSuiteState *state);
+
 #endif /* RENDER_SUITE_SCENES_PIXELS_H */
\ No newline at end of file
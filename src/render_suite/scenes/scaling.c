@@ -1,4 +1,6 @@
 #include "render_suite/scenes/scaling.h"
+#include "render_suite/scenes/scaling_cache.h"
+#include "render_suite/scaler.h"
 
 #include <stdlib.h>
 #include <math.h>
@@ -6,14 +8,6 @@
 #define RS_PI 3.14159265358979323846f
 #define MAX_SCALING_TARGETS 8
 
-// Different resolution test modes
-typedef enum {
-    SCALING_MODE_LOGICAL = 0,
-    SCALING_MODE_VIEWPORT,
-    SCALING_MODE_TEXTURE_TARGET,
-    SCALING_MODE_MAX
-} ScalingMode;
-
 // Resolution configurations to test
 static const struct {
     int width;
@@ -96,8 +90,35 @@ static void rs_draw_test_content(const RenderSuiteState *state,
     }
 }
 
+// Draws the pre-rendered content when available, falling back to issuing
+// the fill rects directly if the cache could not be created.
+static void rs_draw_cached_content(const RenderSuiteState *state,
+                                   SDL_Renderer *renderer,
+                                   SDL_Texture *content,
+                                   int width,
+                                   int height,
+                                   float phase,
+                                   BenchMetrics *metrics)
+{
+    if (!content) {
+        rs_draw_test_content(state, renderer, width, height, phase, metrics);
+        return;
+    }
+
+    SDL_Rect dest = {0, 0, width, height};
+    SDL_RenderCopy(renderer, content, NULL, &dest);
+
+    if (metrics) {
+        metrics->draw_calls++;
+        metrics->vertices_rendered += 4;
+        metrics->triangles_rendered += 2;
+        metrics->texture_switches++;
+    }
+}
+
 static void rs_test_logical_scaling(const RenderSuiteState *state,
                                     SDL_Renderer *renderer,
+                                    SDL_Texture *content,
                                     int target_width,
                                     int target_height,
                                     float phase,
@@ -109,7 +130,7 @@ static void rs_test_logical_scaling(const RenderSuiteState *state,
     SDL_RenderSetLogicalSize(renderer, target_width, target_height);
 
     // Draw test content
-    rs_draw_test_content(state, renderer, target_width, target_height, phase, metrics);
+    rs_draw_cached_content(state, renderer, content, target_width, target_height, phase, metrics);
 
     // Reset logical size
     SDL_RenderSetLogicalSize(renderer, BENCH_SCREEN_W, BENCH_SCREEN_H);
@@ -124,6 +145,7 @@ static void rs_test_logical_scaling(const RenderSuiteState *state,
 
 static void rs_test_viewport_scaling(const RenderSuiteState *state,
                                      SDL_Renderer *renderer,
+                                     SDL_Texture *content,
                                      int target_width,
                                      int target_height,
                                      float center_x,
@@ -158,7 +180,7 @@ static void rs_test_viewport_scaling(const RenderSuiteState *state,
     }
 
     SDL_RenderSetViewport(renderer, &viewport);
-    rs_draw_test_content(state, renderer, viewport.w, viewport.h, phase, metrics);
+    rs_draw_cached_content(state, renderer, content, viewport.w, viewport.h, phase, metrics);
     SDL_RenderSetViewport(renderer, NULL);
 
     Uint64 end_time = SDL_GetPerformanceCounter();
@@ -170,6 +192,7 @@ static void rs_test_viewport_scaling(const RenderSuiteState *state,
 }
 
 static void rs_test_texture_target_scaling(SDL_Renderer *renderer, RenderSuiteState *state,
+                                           SDL_Texture *content,
                                            int target_width, int target_height,
                                            float center_x, float center_y, float phase,
                                            BenchMetrics *metrics)
@@ -202,7 +225,7 @@ static void rs_test_texture_target_scaling(SDL_Renderer *renderer, RenderSuiteSt
     SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
     SDL_RenderClear(renderer);
 
-    rs_draw_test_content(state, renderer, target_width, target_height, phase, metrics);
+    rs_draw_cached_content(state, renderer, content, target_width, target_height, phase, metrics);
 
     SDL_SetRenderTarget(renderer, NULL);
 
@@ -229,6 +252,106 @@ static void rs_test_texture_target_scaling(SDL_Renderer *renderer, RenderSuiteSt
     }
 }
 
+// Software upscale of the cached content into a screen-sized streaming
+// texture, the way emulator front-ends present their framebuffers.
+static void rs_test_cpu_scaling(RenderSuiteState *state,
+                                SDL_Renderer *renderer,
+                                RSScalerKind kind,
+                                RSScalerVariant variant,
+                                int resolution_index,
+                                BenchMetrics *metrics)
+{
+    int src_w = 0;
+    int src_h = 0;
+    const Uint32 *src = rs_scaling_cache_pixels(resolution_index, &src_w, &src_h);
+    if (!state->scaling_cpu_texture || !src) {
+        return;
+    }
+
+    void *pixels = NULL;
+    int pitch = 0;
+    if (SDL_LockTexture(state->scaling_cpu_texture, NULL, &pixels, &pitch) != 0) {
+        return;
+    }
+
+    Uint32 *dst = (Uint32 *)pixels;
+    const int dst_pitch = pitch / (int)sizeof(Uint32);
+    SDL_Rect region = {0, 0, BENCH_SCREEN_W, BENCH_SCREEN_H};
+    if (kind == RS_SCALER_INTEGER) {
+        const int scale = rs_scale_integer_factor(src_w, src_h, BENCH_SCREEN_W, BENCH_SCREEN_H);
+        region.w = src_w * scale;
+        region.h = src_h * scale;
+        region.x = (BENCH_SCREEN_W - region.w) / 2;
+        region.y = (BENCH_SCREEN_H - region.h) / 2;
+    }
+    Uint32 *dst_origin = dst + (size_t)region.y * (size_t)dst_pitch + (size_t)region.x;
+
+    Uint64 start_time = SDL_GetPerformanceCounter();
+
+    switch (kind) {
+        case RS_SCALER_NEAREST:
+            rs_scale_nearest(src, src_w, src_h, src_w,
+                             dst_origin, region.w, region.h, dst_pitch, variant);
+            break;
+        case RS_SCALER_BILINEAR:
+            rs_scale_bilinear(src, src_w, src_h, src_w,
+                              dst_origin, region.w, region.h, dst_pitch, variant);
+            break;
+        default:
+            rs_scale_integer(src, src_w, src_h, src_w,
+                             dst_origin, region.w, region.h, dst_pitch, variant);
+            break;
+    }
+
+    Uint64 end_time = SDL_GetPerformanceCounter();
+    SDL_UnlockTexture(state->scaling_cpu_texture);
+
+    const double elapsed_ms =
+        (double)(end_time - start_time) / (double)SDL_GetPerformanceFrequency() * 1000.0;
+    if (resolution_index < RS_SCALING_RESOLUTION_MAX) {
+        state->scaling_cpu_ms[kind][variant][resolution_index] += elapsed_ms;
+        state->scaling_cpu_runs[kind][variant][resolution_index]++;
+    }
+
+    // Only the scaled region was written; letterbox bars keep the clear colour
+    SDL_RenderCopy(renderer, state->scaling_cpu_texture, &region, &region);
+
+    if (metrics) {
+        metrics->scaling_operations++;
+        metrics->scaling_overhead_ms += elapsed_ms;
+        metrics->texture_switches++;
+        metrics->draw_calls++;
+        metrics->vertices_rendered += 4;
+        metrics->triangles_rendered += 2;
+    }
+}
+
+void rs_scene_scaling_report(const RenderSuiteState *state)
+{
+    if (!state) return;
+
+    for (int kind = 0; kind < RS_SCALER_KIND_MAX; kind++) {
+        for (int i = 0; i < scaling_resolution_count && i < RS_SCALING_RESOLUTION_MAX; i++) {
+            const Uint64 simd_runs = state->scaling_cpu_runs[kind][RS_SCALER_SIMD][i];
+            const Uint64 scalar_runs = state->scaling_cpu_runs[kind][RS_SCALER_SCALAR][i];
+            if (simd_runs == 0 && scalar_runs == 0) {
+                continue;
+            }
+            SDL_Log("CPU scaler %-8s %s -> %dx%d: %s %.3fms (%llu) | %s %.3fms (%llu)",
+                    rs_scaler_name((RSScalerKind)kind),
+                    scaling_resolutions[i].name,
+                    BENCH_SCREEN_W,
+                    BENCH_SCREEN_H,
+                    rs_scaler_variant_name(RS_SCALER_SIMD),
+                    simd_runs ? state->scaling_cpu_ms[kind][RS_SCALER_SIMD][i] / (double)simd_runs : 0.0,
+                    (unsigned long long)simd_runs,
+                    rs_scaler_variant_name(RS_SCALER_SCALAR),
+                    scalar_runs ? state->scaling_cpu_ms[kind][RS_SCALER_SCALAR][i] / (double)scalar_runs : 0.0,
+                    (unsigned long long)scalar_runs);
+        }
+    }
+}
+
 void rs_scene_scaling_init(RenderSuiteState *state, SDL_Renderer *renderer)
 {
     if (!state || !renderer) {
@@ -251,6 +374,20 @@ void rs_scene_scaling_init(RenderSuiteState *state, SDL_Renderer *renderer)
         }
     }
 
+    SDL_Point content_sizes[MAX_SCALING_TARGETS];
+    const int content_count = rs_clampi(scaling_resolution_count, 1, MAX_SCALING_TARGETS);
+    for (int i = 0; i < content_count; i++) {
+        content_sizes[i].x = scaling_resolutions[i].width;
+        content_sizes[i].y = scaling_resolutions[i].height;
+    }
+    rs_scaling_cache_init(renderer, content_sizes, content_count);
+
+    state->scaling_cpu_texture = SDL_CreateTexture(renderer,
+                                                   SDL_PIXELFORMAT_RGBA8888,
+                                                   SDL_TEXTUREACCESS_STREAMING,
+                                                   BENCH_SCREEN_W,
+                                                   BENCH_SCREEN_H);
+
     state->scaling_current_width = BENCH_SCREEN_W;
     state->scaling_current_height = BENCH_SCREEN_H;
     state->scaling_phase = 0.0f;
@@ -272,6 +409,13 @@ void rs_scene_scaling_cleanup(RenderSuiteState *state)
         state->scaling_targets = NULL;
     }
     state->scaling_target_count = 0;
+
+    if (state->scaling_cpu_texture) {
+        SDL_DestroyTexture(state->scaling_cpu_texture);
+        state->scaling_cpu_texture = NULL;
+    }
+    rs_scaler_cleanup();
+    rs_scaling_cache_cleanup();
 }
 
 void rs_scene_scaling(RenderSuiteState *state,
@@ -293,7 +437,7 @@ void rs_scene_scaling(RenderSuiteState *state,
 
     // Cycle through different resolution modes
     const float cycle_speed = 0.3f + factor * 0.2f;
-    const int current_mode = ((int)(state->scaling_phase * cycle_speed)) % SCALING_MODE_MAX;
+    const int current_mode = ((int)(state->scaling_phase * cycle_speed)) % RS_SCALING_MODE_MAX;
     const int resolution_index = ((int)(state->scaling_phase * cycle_speed * 0.5f)) % scaling_resolution_count;
 
     int target_width = scaling_resolutions[resolution_index].width;
@@ -308,26 +452,43 @@ void rs_scene_scaling(RenderSuiteState *state,
         int test_width = scaling_resolutions[test_resolution].width;
         int test_height = scaling_resolutions[test_resolution].height;
 
+        // Fetch content before the timed section so only scaling is measured
+        SDL_Texture *content = rs_scaling_cache_get(state, test_resolution, test_phase, metrics);
+
         switch (current_mode) {
-            case SCALING_MODE_LOGICAL:
-                rs_test_logical_scaling(state, renderer, test_width, test_height, test_phase, metrics);
+            case RS_SCALING_MODE_LOGICAL:
+                rs_test_logical_scaling(state, renderer, content, test_width, test_height,
+                                        test_phase, metrics);
                 break;
 
-            case SCALING_MODE_VIEWPORT:
-                rs_test_viewport_scaling(state, renderer, test_width, test_height,
+            case RS_SCALING_MODE_VIEWPORT:
+                rs_test_viewport_scaling(state, renderer, content, test_width, test_height,
                                        center_x, center_y, test_phase, metrics);
                 break;
 
-            case SCALING_MODE_TEXTURE_TARGET:
-                rs_test_texture_target_scaling(renderer, state, test_width, test_height,
+            case RS_SCALING_MODE_TEXTURE_TARGET:
+                rs_test_texture_target_scaling(renderer, state, content, test_width, test_height,
                                               center_x, center_y, test_phase, metrics);
                 break;
+
+            case RS_SCALING_MODE_CPU_NEAREST:
+            case RS_SCALING_MODE_CPU_BILINEAR:
+            case RS_SCALING_MODE_CPU_INTEGER:
+                // Alternate variants so both accumulate samples at every resolution
+                rs_test_cpu_scaling(state, renderer,
+                                    (RSScalerKind)(current_mode - RS_SCALING_MODE_CPU_NEAREST),
+                                    (RSScalerVariant)((state->scaling_cpu_frame + test) & 1),
+                                    test_resolution, metrics);
+                break;
         }
     }
 
     // Update state for overlay display
     state->scaling_current_width = target_width;
     state->scaling_current_height = target_height;
+    state->scaling_mode = current_mode;
+    state->scaling_resolution = resolution_index;
+    state->scaling_cpu_frame++;
 
     // Draw mode indicator
     SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
@@ -14,4 +14,7 @@ void rs_scene_scaling(RenderSuiteState *state,
 void rs_scene_scaling_init(RenderSuiteState *state, SDL_Renderer *renderer);
 void rs_scene_scaling_cleanup(RenderSuiteState *state);
 
+// Logs CPU scaler timings per resolution
+void rs_scene_scaling_report(const RenderSuiteState *state);
+
 #endif /* RENDER_SUITE_SCENES_SCALING_H */
\ No newline at end of file
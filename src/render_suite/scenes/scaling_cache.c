@@ -0,0 +1,196 @@
+#include "render_suite/scenes/scaling_cache.h"
+#include "render_suite/render_neon.h"
+
+#include <stdlib.h>
+#include <math.h>
+
+#define RS_PI 3.14159265358979323846f
+#define SCALING_CACHE_BAR_COUNT 8
+#define SCALING_CACHE_SHAPE_COUNT 4
+
+typedef struct {
+    SDL_Texture *texture;
+    Uint32 *pixels;
+    int width;
+    int height;
+    int bucket;
+} ScalingCacheEntry;
+
+typedef struct {
+    ScalingCacheEntry entries[RS_SCALING_CACHE_MAX];
+    int count;
+} ScalingCache;
+
+static ScalingCache g_scaling_cache = {0};
+
+static void rs_scaling_cache_fill_rect(ScalingCacheEntry *entry, int x, int y, int w, int h, Uint32 color)
+{
+    const int x0 = SDL_max(x, 0);
+    const int y0 = SDL_max(y, 0);
+    const int x1 = SDL_min(x + w, entry->width);
+    const int y1 = SDL_min(y + h, entry->height);
+    if (x1 <= x0 || y1 <= y0) {
+        return;
+    }
+
+    for (int row = y0; row < y1; ++row) {
+        rs_neon_fill_u32(entry->pixels + (size_t)row * (size_t)entry->width + x0,
+                         color,
+                         (size_t)(x1 - x0));
+    }
+}
+
+// CPU replica of the scene's test content: gradient bars become a continuous
+// colour ramp between the bar colours, followed by the moving white squares.
+static void rs_scaling_cache_render(const RenderSuiteState *state,
+                                    ScalingCacheEntry *entry,
+                                    float phase)
+{
+    const int width = entry->width;
+    const int height = entry->height;
+    Uint32 *first_row = entry->pixels;
+
+    int32_t stop_r[SCALING_CACHE_BAR_COUNT];
+    int32_t stop_g[SCALING_CACHE_BAR_COUNT];
+    int32_t stop_b[SCALING_CACHE_BAR_COUNT];
+    for (int i = 0; i < SCALING_CACHE_BAR_COUNT; ++i) {
+        const float t = (float)i / (float)(SCALING_CACHE_BAR_COUNT - 1);
+        const float wave = rs_state_sin_rad(state, phase + t * RS_PI * 4.0f) * 0.5f + 0.5f;
+        stop_r[i] = (int32_t)(128 + wave * 127) << 16;
+        stop_g[i] = (int32_t)(64 + t * 191) << 16;
+        stop_b[i] = (int32_t)(192 - t * 127) << 16;
+    }
+
+    const int segments = SCALING_CACHE_BAR_COUNT - 1;
+    for (int seg = 0; seg < segments; ++seg) {
+        const int x0 = (seg * (width - 1)) / segments;
+        const int x1 = ((seg + 1) * (width - 1)) / segments;
+        const int span = SDL_max(1, x1 - x0);
+        const int count = (seg == segments - 1) ? (x1 - x0 + 1) : (x1 - x0);
+        if (count <= 0) {
+            continue;
+        }
+        rs_neon_ramp_rgba8888(first_row + x0,
+                              (size_t)count,
+                              stop_r[seg],
+                              stop_g[seg],
+                              stop_b[seg],
+                              (stop_r[seg + 1] - stop_r[seg]) / span,
+                              (stop_g[seg + 1] - stop_g[seg]) / span,
+                              (stop_b[seg + 1] - stop_b[seg]) / span);
+    }
+
+    for (int row = 1; row < height; ++row) {
+        rs_neon_copy_u32(entry->pixels + (size_t)row * (size_t)width, first_row, (size_t)width);
+    }
+
+    const float radius = (float)SDL_min(width, height) * 0.2f;
+    for (int i = 0; i < SCALING_CACHE_SHAPE_COUNT; ++i) {
+        const float angle = phase + (float)i * RS_PI * 2.0f / (float)SCALING_CACHE_SHAPE_COUNT;
+        const int cx = (int)((float)width * 0.5f + rs_state_cos_rad(state, angle) * radius * 0.5f);
+        const int cy = (int)((float)height * 0.5f + rs_state_sin_rad(state, angle) * radius * 0.5f);
+        const int size = (int)(8.0f + 8.0f * rs_state_sin_rad(state, phase * 2.0f + (float)i));
+        rs_scaling_cache_fill_rect(entry, cx - size / 2, cy - size / 2, size, size, 0xFFFFFFFFu);
+    }
+}
+
+void rs_scaling_cache_init(SDL_Renderer *renderer, const SDL_Point *sizes, int count)
+{
+    rs_scaling_cache_cleanup();
+    if (!renderer || !sizes) {
+        return;
+    }
+
+    const int clamped = SDL_min(count, RS_SCALING_CACHE_MAX);
+    for (int i = 0; i < clamped; ++i) {
+        ScalingCacheEntry *entry = &g_scaling_cache.entries[i];
+        entry->width = sizes[i].x;
+        entry->height = sizes[i].y;
+        entry->bucket = -1;
+        entry->pixels = malloc(sizeof(Uint32) * (size_t)entry->width * (size_t)entry->height);
+        entry->texture = SDL_CreateTexture(renderer,
+                                           SDL_PIXELFORMAT_RGBA8888,
+                                           SDL_TEXTUREACCESS_STATIC,
+                                           entry->width,
+                                           entry->height);
+        if (!entry->pixels || !entry->texture) {
+            free(entry->pixels);
+            entry->pixels = NULL;
+            if (entry->texture) {
+                SDL_DestroyTexture(entry->texture);
+                entry->texture = NULL;
+            }
+        }
+    }
+    g_scaling_cache.count = clamped;
+}
+
+void rs_scaling_cache_cleanup(void)
+{
+    for (int i = 0; i < g_scaling_cache.count; ++i) {
+        ScalingCacheEntry *entry = &g_scaling_cache.entries[i];
+        if (entry->texture) {
+            SDL_DestroyTexture(entry->texture);
+        }
+        free(entry->pixels);
+    }
+    SDL_memset(&g_scaling_cache, 0, sizeof(g_scaling_cache));
+}
+
+SDL_Texture *rs_scaling_cache_get(const RenderSuiteState *state,
+                                  int index,
+                                  float phase,
+                                  BenchMetrics *metrics)
+{
+    if (!state || index < 0 || index >= g_scaling_cache.count) {
+        return NULL;
+    }
+
+    ScalingCacheEntry *entry = &g_scaling_cache.entries[index];
+    if (!entry->texture || !entry->pixels) {
+        return NULL;
+    }
+
+    // Content is periodic in 2*pi, so buckets wrap and are reused every cycle
+    const float bucket_span = (2.0f * RS_PI) / (float)RS_SCALING_CACHE_BUCKETS;
+    int bucket = (int)floorf(phase / bucket_span) % RS_SCALING_CACHE_BUCKETS;
+    if (bucket < 0) {
+        bucket += RS_SCALING_CACHE_BUCKETS;
+    }
+
+    if (bucket != entry->bucket) {
+        Uint64 start_time = SDL_GetPerformanceCounter();
+
+        rs_scaling_cache_render(state, entry, (float)bucket * bucket_span);
+        SDL_UpdateTexture(entry->texture, NULL, entry->pixels, entry->width * (int)sizeof(Uint32));
+        entry->bucket = bucket;
+
+        Uint64 end_time = SDL_GetPerformanceCounter();
+        if (metrics) {
+            metrics->content_rebuilds++;
+            metrics->content_generation_ms +=
+                (double)(end_time - start_time) / (double)SDL_GetPerformanceFrequency() * 1000.0;
+        }
+    }
+
+    return entry->texture;
+}
+
+const Uint32 *rs_scaling_cache_pixels(int index, int *width, int *height)
+{
+    if (index < 0 || index >= g_scaling_cache.count) {
+        return NULL;
+    }
+
+    const ScalingCacheEntry *entry = &g_scaling_cache.entries[index];
+    if (!entry->pixels || entry->bucket < 0) {
+        return NULL;
+    }
+    if (width) {
+        *width = entry->width;
+    }
+    if (height) {
+        *height = entry->height;
+    }
+    return entry->pixels;
+}
@@ -0,0 +1,25 @@
+#ifndef RENDER_SUITE_SCENES_SCALING_CACHE_H
+#define RENDER_SUITE_SCENES_SCALING_CACHE_H
+
+#include <SDL2/SDL.h>
+
+#include "bench_common.h"
+#include "render_suite/state.h"
+
+#define RS_SCALING_CACHE_MAX 8
+#define RS_SCALING_CACHE_BUCKETS 16 // Phase buckets per 2*pi content cycle
+
+void rs_scaling_cache_init(SDL_Renderer *renderer, const SDL_Point *sizes, int count);
+void rs_scaling_cache_cleanup(void);
+
+// Returns the pre-rendered content texture for a resolution, rebuilding it
+// only when the phase has moved into a new bucket.
+SDL_Texture *rs_scaling_cache_get(const RenderSuiteState *state,
+                                  int index,
+                                  float phase,
+                                  BenchMetrics *metrics);
+
+// CPU copy of the content last produced by rs_scaling_cache_get.
+const Uint32 *rs_scaling_cache_pixels(int index, int *width, int *height);
+
+#endif /* RENDER_SUITE_SCENES_SCALING_CACHE_H */
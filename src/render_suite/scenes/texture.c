@@ -1,4 +1,20 @@
 #include "render_suite/scenes/texture.h"
+#include "render_suite/resources.h"
+
+void rs_scene_texture_init(RenderSuiteState *state, SDL_Renderer *renderer)
+{
+    if (!state || !renderer || state->checker_texture) return;
+
+    state->checker_texture = rs_create_checker_texture(renderer, 192, 192);
+}
+
+void rs_scene_texture_cleanup(RenderSuiteState *state)
+{
+    if (state && state->checker_texture) {
+        SDL_DestroyTexture(state->checker_texture);
+        state->checker_texture = NULL;
+    }
+}
 
 void rs_scene_texture(RenderSuiteState *state,
                       SDL_Renderer *renderer,
@@ -8,4 +8,8 @@ void rs_scene_texture(RenderSuiteState *state,
                       BenchMetrics *metrics,
                       double delta_seconds);
 
+// The checker texture only lives while the scene is on screen
+void rs_scene_texture_init(RenderSuiteState *state, SDL_Renderer *renderer);
+void rs_scene_texture_cleanup(RenderSuiteState *state);
+
 #endif /* RENDER_SUITE_SCENES_TEXTURE_H */
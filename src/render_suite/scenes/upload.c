@@ -0,0 +1,239 @@
+#include "render_suite/scenes/upload.h"
+#include "render_suite/render_neon.h"
+
+#include <stdlib.h>
+
+#define UPLOAD_WIDTH BENCH_SCREEN_W
+#define UPLOAD_HEIGHT BENCH_SCREEN_H
+#define UPLOAD_SUBRECT_WIDTH (UPLOAD_WIDTH / 2)
+#define UPLOAD_SUBRECT_HEIGHT (UPLOAD_HEIGHT / 2)
+
+static const char *upload_method_names[RS_UPLOAD_METHOD_MAX] = {
+    "UpdateTexture",
+    "LockTexture",
+    "LockToSurface",
+    "TargetBlit"
+};
+
+/*
+ * The same RGBA8888 frame goes through every path. `textures` is indexed by
+ * RS_UPLOAD_VARIANT_STATIC; TargetBlit uses them as its staging texture and
+ * draws into `target`. `frame_surface` wraps `frame` for the surface blit.
+ */
+typedef struct {
+    Uint32 *frame;
+    SDL_Surface *frame_surface;
+    SDL_Texture *textures[2];
+    SDL_Texture *target;
+    float phase;
+} UploadBench;
+
+static UploadBench g_upload_bench;
+
+SDL_bool rs_scene_upload_supported(int method, int variant)
+{
+    const SDL_bool lock = (method == RS_UPLOAD_LOCK_COPY || method == RS_UPLOAD_LOCK_SURFACE) ?
+        SDL_TRUE : SDL_FALSE;
+    return (lock && (variant & RS_UPLOAD_VARIANT_STATIC)) ? SDL_FALSE : SDL_TRUE;
+}
+
+static SDL_Texture *rs_upload_create_texture(SDL_Renderer *renderer, int access)
+{
+    SDL_Texture *texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, access,
+                                             UPLOAD_WIDTH, UPLOAD_HEIGHT);
+    if (texture) {
+        SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_NONE);
+    }
+    return texture;
+}
+
+void rs_scene_upload_init(RenderSuiteState *state, SDL_Renderer *renderer)
+{
+    if (!state) return;
+
+    UploadBench *bench = &g_upload_bench;
+    SDL_memset(bench, 0, sizeof(*bench));
+
+    bench->frame = calloc((size_t)UPLOAD_WIDTH * UPLOAD_HEIGHT, sizeof(Uint32));
+    if (bench->frame) {
+        bench->frame_surface = SDL_CreateRGBSurfaceWithFormatFrom(bench->frame,
+                                                                  UPLOAD_WIDTH,
+                                                                  UPLOAD_HEIGHT,
+                                                                  32,
+                                                                  UPLOAD_WIDTH * (int)sizeof(Uint32),
+                                                                  SDL_PIXELFORMAT_RGBA8888);
+        if (bench->frame_surface) {
+            // Plain copy, no blending, so the blit measures transfer only
+            SDL_SetSurfaceBlendMode(bench->frame_surface, SDL_BLENDMODE_NONE);
+        }
+    }
+
+    if (renderer) {
+        bench->textures[0] = rs_upload_create_texture(renderer, SDL_TEXTUREACCESS_STREAMING);
+        bench->textures[1] = rs_upload_create_texture(renderer, SDL_TEXTUREACCESS_STATIC);
+        bench->target = rs_upload_create_texture(renderer, SDL_TEXTUREACCESS_TARGET);
+    }
+}
+
+void rs_scene_upload_report(const RenderSuiteState *state)
+{
+    if (!state) return;
+
+    for (int method = 0; method < RS_UPLOAD_METHOD_MAX; ++method) {
+        for (int variant = 0; variant < RS_UPLOAD_VARIANTS; ++variant) {
+            const Uint64 runs = state->upload_runs[method][variant];
+            if (runs == 0) {
+                continue;
+            }
+            const double us = state->upload_us[method][variant];
+            SDL_Log("Upload %-13s %-9s %-9s: %.1fus | %.1f MB/s (%llu)",
+                    upload_method_names[method],
+                    (variant & RS_UPLOAD_VARIANT_SUBRECT) ? "sub-rect" : "full",
+                    (variant & RS_UPLOAD_VARIANT_STATIC) ? "static" : "streaming",
+                    us / (double)runs,
+                    us > 0.0 ? (double)state->upload_bytes[method][variant] / us : 0.0,
+                    (unsigned long long)runs);
+        }
+    }
+}
+
+void rs_scene_upload_cleanup(RenderSuiteState *state)
+{
+    UploadBench *bench = &g_upload_bench;
+    (void)state;
+
+    if (bench->frame_surface) {
+        SDL_FreeSurface(bench->frame_surface);
+    }
+    free(bench->frame);
+    for (int i = 0; i < 2; ++i) {
+        if (bench->textures[i]) {
+            SDL_DestroyTexture(bench->textures[i]);
+        }
+    }
+    if (bench->target) {
+        SDL_DestroyTexture(bench->target);
+    }
+    SDL_memset(bench, 0, sizeof(*bench));
+}
+
+// Scrolling diagonal ramp so every upload carries a visibly new frame
+static void rs_upload_animate(UploadBench *bench, double delta_seconds)
+{
+    bench->phase += (float)(delta_seconds * 120.0);
+    if (bench->phase >= 256.0f) {
+        bench->phase -= 256.0f;
+    }
+    const int shift = (int)bench->phase;
+    for (int y = 0; y < UPLOAD_HEIGHT; ++y) {
+        const int32_t start = ((y + shift) & 0x7F) << 16;
+        rs_neon_ramp_rgba8888(bench->frame + (size_t)y * UPLOAD_WIDTH,
+                              UPLOAD_WIDTH,
+                              start,
+                              (y * 255 / UPLOAD_HEIGHT) << 16,
+                              128 << 16,
+                              (127 << 16) / UPLOAD_WIDTH,
+                              0,
+                              -(96 << 16) / UPLOAD_WIDTH);
+    }
+}
+
+static void rs_upload_lock_copy(SDL_Texture *texture, const SDL_Rect *rect, const Uint32 *src)
+{
+    void *pixels = NULL;
+    int pitch = 0;
+    if (SDL_LockTexture(texture, rect, &pixels, &pitch) != 0) {
+        return;
+    }
+    for (int y = 0; y < rect->h; ++y) {
+        rs_neon_copy_u32((uint32_t *)((Uint8 *)pixels + (size_t)y * (size_t)pitch),
+                         src + (size_t)y * UPLOAD_WIDTH,
+                         (size_t)rect->w);
+    }
+    SDL_UnlockTexture(texture);
+}
+
+static void rs_upload_lock_surface(SDL_Texture *texture, const SDL_Rect *rect, SDL_Surface *frame_surface)
+{
+    SDL_Surface *surface = NULL;
+    if (!frame_surface || SDL_LockTextureToSurface(texture, rect, &surface) != 0) {
+        return;
+    }
+    SDL_BlitSurface(frame_surface, rect, surface, NULL);
+    SDL_UnlockTexture(texture);
+}
+
+void rs_scene_upload(RenderSuiteState *state,
+                     SDL_Renderer *renderer,
+                     BenchMetrics *metrics,
+                     double delta_seconds)
+{
+    UploadBench *bench = &g_upload_bench;
+    if (!state || !renderer || !bench->frame) {
+        return;
+    }
+
+    const int method = SDL_clamp(state->upload_method, 0, RS_UPLOAD_METHOD_MAX - 1);
+    const int variant = SDL_clamp(state->upload_variant, 0, RS_UPLOAD_VARIANTS - 1);
+    SDL_Texture *texture = bench->textures[(variant & RS_UPLOAD_VARIANT_STATIC) ? 1 : 0];
+    if (!texture || !rs_scene_upload_supported(method, variant) ||
+        (method == RS_UPLOAD_TARGET_BLIT && !bench->target)) {
+        return;
+    }
+
+    rs_upload_animate(bench, delta_seconds);
+
+    const SDL_Rect full = {0, 0, UPLOAD_WIDTH, UPLOAD_HEIGHT};
+    const SDL_Rect sub = {
+        (UPLOAD_WIDTH - UPLOAD_SUBRECT_WIDTH) / 2,
+        (UPLOAD_HEIGHT - UPLOAD_SUBRECT_HEIGHT) / 2,
+        UPLOAD_SUBRECT_WIDTH,
+        UPLOAD_SUBRECT_HEIGHT
+    };
+    const SDL_Rect *rect = (variant & RS_UPLOAD_VARIANT_SUBRECT) ? &sub : &full;
+    const Uint32 *src = bench->frame + (size_t)rect->y * UPLOAD_WIDTH + (size_t)rect->x;
+    const int src_pitch = UPLOAD_WIDTH * (int)sizeof(Uint32);
+
+    const Uint64 start = SDL_GetPerformanceCounter();
+    switch (method) {
+        case RS_UPLOAD_UPDATE_TEXTURE:
+            SDL_UpdateTexture(texture, rect, src, src_pitch);
+            break;
+        case RS_UPLOAD_LOCK_COPY:
+            rs_upload_lock_copy(texture, rect, src);
+            break;
+        case RS_UPLOAD_LOCK_SURFACE:
+            rs_upload_lock_surface(texture, rect, bench->frame_surface);
+            break;
+        case RS_UPLOAD_TARGET_BLIT:
+            // Switching targets flushes the batch, so the copy is really issued here
+            SDL_UpdateTexture(texture, rect, src, src_pitch);
+            SDL_SetRenderTarget(renderer, bench->target);
+            SDL_RenderCopy(renderer, texture, rect, rect);
+            SDL_SetRenderTarget(renderer, NULL);
+            texture = bench->target;
+            break;
+        default:
+            break;
+    }
+    const double us = (double)(SDL_GetPerformanceCounter() - start) /
+                      (double)SDL_GetPerformanceFrequency() * 1000000.0;
+    const Uint64 bytes = (Uint64)rect->w * (Uint64)rect->h * sizeof(Uint32);
+
+    state->upload_us[method][variant] += us;
+    state->upload_bytes[method][variant] += bytes;
+    state->upload_runs[method][variant]++;
+
+    const int region_height = SDL_max(1, BENCH_SCREEN_H - (int)state->top_margin);
+    const SDL_Rect dest = {0, (int)state->top_margin, BENCH_SCREEN_W, region_height};
+    SDL_RenderCopy(renderer, texture, NULL, &dest);
+
+    if (metrics) {
+        metrics->lock_unlock_overhead_ms += us / 1000.0;
+        metrics->pixel_operations += (Uint64)rect->w * (Uint64)rect->h;
+        metrics->draw_calls += (method == RS_UPLOAD_TARGET_BLIT) ? 2 : 1;
+        metrics->vertices_rendered += (method == RS_UPLOAD_TARGET_BLIT) ? 8 : 4;
+        metrics->triangles_rendered += (method == RS_UPLOAD_TARGET_BLIT) ? 4 : 2;
+        metrics->texture_switches++;
+    }
+}
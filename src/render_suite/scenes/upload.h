@@ -0,0 +1,21 @@
+#ifndef RENDER_SUITE_SCENES_UPLOAD_H
+#define RENDER_SUITE_SCENES_UPLOAD_H
+
+#include <SDL2/SDL.h>
+
+#include "bench_common.h"
+#include "render_suite/state.h"
+
+void rs_scene_upload(RenderSuiteState *state,
+                     SDL_Renderer *renderer,
+                     BenchMetrics *metrics,
+                     double delta_seconds);
+
+void rs_scene_upload_init(RenderSuiteState *state, SDL_Renderer *renderer);
+void rs_scene_upload_cleanup(RenderSuiteState *state);
+void rs_scene_upload_report(const RenderSuiteState *state);
+
+// Lock-based methods need a streaming texture, so they have no static variant
+SDL_bool rs_scene_upload_supported(int method, int variant);
+
+#endif /* RENDER_SUITE_SCENES_UPLOAD_H */
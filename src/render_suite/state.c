@@ -35,6 +35,7 @@ void rs_state_init(RenderSuiteState *state)
     state->has_neon = RS_HAS_NEON ? SDL_TRUE : SDL_FALSE;
 
     state->geometry_render_mode = RS_GEOMETRY_RENDER_FILLED;
+    state->convert_dst_format = RS_CONVERT_RGBA8888;
 }
 
 void rs_state_update_layout(RenderSuiteState *state, BenchOverlay *overlay)
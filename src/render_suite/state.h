@@ -5,8 +5,11 @@
 #include <SDL2/SDL_ttf.h>
 
 #include "bench_common.h"
+#include "render_suite/pixel_convert.h"
+#include "render_suite/scaler.h"
 
 #define RS_SIN_TABLE_SIZE 512
+#define RS_SCALING_RESOLUTION_MAX 8
 
 typedef enum {
     SCENE_FILL = 0,
@@ -16,6 +19,9 @@ typedef enum {
     SCENE_SCALING,
     SCENE_MEMORY,
     SCENE_PIXELS,
+    SCENE_CONVERT,
+    SCENE_BANDWIDTH,
+    SCENE_UPLOAD,
     SCENE_MAX
 } SceneKind;
 
@@ -26,10 +32,93 @@ typedef enum {
     RS_GEOMETRY_RENDER_MODE_MAX
 } RSGeometryRenderMode;
 
+typedef enum {
+    RS_SCALING_MODE_LOGICAL = 0,
+    RS_SCALING_MODE_VIEWPORT,
+    RS_SCALING_MODE_TEXTURE_TARGET,
+    RS_SCALING_MODE_CPU_NEAREST,
+    RS_SCALING_MODE_CPU_BILINEAR,
+    RS_SCALING_MODE_CPU_INTEGER,
+    RS_SCALING_MODE_MAX
+} RSScalingMode;
+
+typedef enum {
+    RS_PIXEL_MODE_PLASMA = 0,
+    RS_PIXEL_MODE_FIRE,
+    RS_PIXEL_MODE_MANDELBROT,
+    RS_PIXEL_MODE_CELLULAR,
+    RS_PIXEL_MODE_MAX
+} RSPixelMode;
+
+typedef enum {
+    RS_MEMORY_MODE_CHURN = 0,  // Create and destroy textures as resources expire
+    RS_MEMORY_MODE_POOLED,     // Recycle them through an RSTexturePool
+    RS_MEMORY_MODE_MAX
+} RSMemoryMode;
+
+typedef enum {
+    RS_LINES_MODE_PER_LINE = 0, // SDL_RenderDrawLineF per line
+    RS_LINES_MODE_BATCHED,      // One SDL_RenderGeometry of 1px quads
+    RS_LINES_MODE_BATCHED_AA,   // Same, with wider lines and feathered edges
+    RS_LINES_MODE_MAX
+} RSLinesMode;
+
+typedef enum {
+    RS_CONVERT_PATH_SDL = 0,   // SDL_ConvertPixels to the destination format, then upload
+    RS_CONVERT_PATH_UPLOAD,    // Upload the source format as-is and let SDL/GL cope
+    RS_CONVERT_PATH_SCALAR,    // rs_convert_pixels scalar, then upload
+    RS_CONVERT_PATH_SIMD,      // rs_convert_pixels NEON, then upload
+    RS_CONVERT_PATH_MAX
+} RSConvertPath;
+
+typedef enum {
+    RS_BANDWIDTH_READ = 0,
+    RS_BANDWIDTH_WRITE,
+    RS_BANDWIDTH_COPY_MEMCPY,      // libc memcpy
+    RS_BANDWIDTH_COPY_NEON_U32,    // rs_neon_copy_u32
+    RS_BANDWIDTH_COPY_NEON_MEMCPY, // neon_memcpy via rs_memcpy
+    RS_BANDWIDTH_TEST_MAX
+} RSBandwidthTest;
+
+#define RS_BANDWIDTH_SIZES 14 // Working sets 4 KiB << 0..13, up to 32 MiB
+#define RS_BANDWIDTH_KNEES 3  // Cache levels detected from the latency curve
+
+typedef enum {
+    RS_UPLOAD_UPDATE_TEXTURE = 0, // SDL_UpdateTexture
+    RS_UPLOAD_LOCK_COPY,          // SDL_LockTexture + row copy, as the pixels scene does
+    RS_UPLOAD_LOCK_SURFACE,       // SDL_LockTextureToSurface + SDL_BlitSurface
+    RS_UPLOAD_TARGET_BLIT,        // Update a staging texture, RenderCopy it into a target
+    RS_UPLOAD_METHOD_MAX
+} RSUploadMethod;
+
+// Upload variants are bit flags: sub-rect instead of full frame, static instead of streaming
+#define RS_UPLOAD_VARIANT_SUBRECT 1
+#define RS_UPLOAD_VARIANT_STATIC 2
+#define RS_UPLOAD_VARIANTS 4
+
+#define RS_STRESS_LEVEL_MAX 10
+#define RS_SATURATION_TARGETS 2 // Frame-time budgets for the saturation search: 60 and 30 FPS
+#define RS_PIXEL_THREADS_MAX 2 // 0 in pixel_threads alternates between 1 and 2
+#define RS_PIXEL_LIFE_GRIDS 3   // Cellular grid sizes cycled by X
+
+// Outcome of a saturation search for one scene against one frame-time target
+typedef struct {
+    SDL_bool measured;
+    int level;                 // Highest stress level whose p95 met the target, 0 if none did
+    double p95_ms;             // p95 frame time at that level
+    double draw_calls_per_s;
+    double vertices_per_s;
+} RSSaturationResult;
+
 typedef struct {
     SceneKind active_scene;
     SDL_bool auto_cycle;
     int stress_level;
+    SDL_bool saturation_running;          // L1 toggles the search, which drives scene and stress
+    int saturation_target;                // Index of the frame-time target, cycled by R1
+    int saturation_probe_level;           // Level under test while running
+    double saturation_probe_p95_ms;       // p95 of the last finished probe
+    RSSaturationResult saturation_results[RS_SATURATION_TARGETS][SCENE_MAX];
     float texture_angle;
     float top_margin;
     TTF_Font *font;
@@ -41,9 +130,15 @@ typedef struct {
     int sin_table_mask;
 
     float fill_phase_units;
+    SDL_bool fill_batched;               // Columns submitted as one RenderGeometry
+    double fill_submit_ms[2];            // [0] per-rect, [1] batched
+    Uint64 fill_submit_runs[2];
     float texture_phase_units;
     float lines_cursor_progress;
     int lines_cursor_index;
+    int lines_mode;
+    double lines_submit_ms[RS_LINES_MODE_MAX][RS_STRESS_LEVEL_MAX]; // Indexed by stress level - 1
+    Uint64 lines_submit_runs[RS_LINES_MODE_MAX][RS_STRESS_LEVEL_MAX];
 
     float geometry_rotation;
     int geometry_triangle_count;
@@ -55,16 +150,88 @@ typedef struct {
     float scaling_phase;
     SDL_Texture **scaling_targets;
     int scaling_target_count;
+    int scaling_mode;
+    int scaling_resolution;
+    int scaling_cpu_frame;
+    SDL_Texture *scaling_cpu_texture;
+    double scaling_cpu_ms[RS_SCALER_KIND_MAX][RS_SCALER_VARIANT_MAX][RS_SCALING_RESOLUTION_MAX];
+    Uint64 scaling_cpu_runs[RS_SCALER_KIND_MAX][RS_SCALER_VARIANT_MAX][RS_SCALING_RESOLUTION_MAX];
 
     float resources_phase;
     SDL_Texture **resource_textures;
     int resource_texture_count;
     int resource_allocation_index;
+    int memory_mode;
+    double memory_alloc_ms[RS_MEMORY_MODE_MAX];    // Texture + staging allocation only
+    Uint64 memory_alloc_count[RS_MEMORY_MODE_MAX];
+    Uint64 memory_pool_hits;              // Summed across scene re-inits, like the counters above
+    Uint64 memory_pool_misses;
+    double memory_pool_hit_rate;
+    double memory_pool_waste;
+    Uint64 memory_pool_evictions;
+    Uint64 memory_pool_resident_bytes;
+    Uint64 memory_pool_budget_bytes;
+    SDL_bool memory_async;                // Content generated on a producer thread
+    double memory_queue_depth;            // Mean ready items seen by the render thread
+    double memory_producer_busy;          // Share of producer time spent generating
+    Uint64 memory_content_misses;         // Fills generated inline because no item was ready
+    double memory_upload_ms;              // Render-thread lock + copy time
+    Uint64 memory_upload_frames;
+
+    int convert_format;                   // Source
+    int convert_dst_format;
+    int convert_path;
+    // [source][destination][path]; the direct upload ignores the destination
+    double convert_cpu_ms[RS_CONVERT_FORMAT_MAX][RS_CONVERT_FORMAT_MAX][RS_CONVERT_PATH_MAX];    // Conversion only
+    double convert_upload_ms[RS_CONVERT_FORMAT_MAX][RS_CONVERT_FORMAT_MAX][RS_CONVERT_PATH_MAX]; // SDL_UpdateTexture only
+    Uint64 convert_runs[RS_CONVERT_FORMAT_MAX][RS_CONVERT_FORMAT_MAX][RS_CONVERT_PATH_MAX];
+    int convert_check_mismatches;         // Pixels where SDL, scalar and SIMD disagree
+
+    double bandwidth_mbps[RS_BANDWIDTH_TEST_MAX][RS_BANDWIDTH_SIZES]; // 0 until measured
+    double bandwidth_latency_ns[RS_BANDWIDTH_SIZES];
+    int bandwidth_sizes;                  // Working sets the probe buffer allows
+    int bandwidth_step;                   // Measurements completed in this sweep
+    int bandwidth_knee_bytes[RS_BANDWIDTH_KNEES]; // Last working set before each latency jump
+    int bandwidth_knee_count;
+    SDL_bool bandwidth_exported;
+
+    int upload_method;
+    int upload_variant;
+    double upload_us[RS_UPLOAD_METHOD_MAX][RS_UPLOAD_VARIANTS];
+    Uint64 upload_bytes[RS_UPLOAD_METHOD_MAX][RS_UPLOAD_VARIANTS];
+    Uint64 upload_runs[RS_UPLOAD_METHOD_MAX][RS_UPLOAD_VARIANTS];
 
     SDL_Surface *pixel_surface;
     void *pixel_buffer;
     float pixel_phase;
     int pixel_plasma_offset;
+    int pixel_mode;
+    int pixel_threads;
+    double pixel_generate_ms[RS_PIXEL_MODE_MAX][RS_PIXEL_THREADS_MAX];
+    Uint64 pixel_generate_runs[RS_PIXEL_MODE_MAX][RS_PIXEL_THREADS_MAX];
+    double pixel_upload_ms;
+    double pixel_overlap_ms;
+    double pixel_plasma_ref_mps;
+    double pixel_plasma_simd_mps;
+    int pixel_plasma_max_diff;
+    SDL_bool pixel_plasma_check_ok;
+    int pixel_mandel_check_mismatches;   // Pixels off the reference escape counts
+    int pixel_life_check_mismatches;     // Cells off the reference engine, -1 if not run
+    int pixel_option[RS_PIXEL_MODE_MAX]; // Per-effect X option index
+    double pixel_fire_ms;
+    Uint64 pixel_fire_cells;
+    int pixel_fire_width;
+    int pixel_fire_height;
+    double pixel_life_ms;
+    Uint64 pixel_life_cells;
+    int pixel_life_width;
+    int pixel_life_height;
+    double pixel_mandel_ms;
+    Uint64 pixel_mandel_samples;
+    Uint64 pixel_mandel_iterations;
+    Uint64 pixel_mandel_skipped;
+    int pixel_mandel_max_iterations;
+    int pixel_mandel_pass;
 
     SDL_bool has_neon;
 } RenderSuiteState;
@@ -0,0 +1,159 @@
+#include "render_suite/texture_pool.h"
+
+#include <stdlib.h>
+
+static int rs_texture_pool_class(int size)
+{
+    int edge = RS_TEXTURE_POOL_MIN_CLASS;
+    while (edge < size) {
+        edge <<= 1;
+    }
+    return edge;
+}
+
+static void rs_texture_pool_destroy_entry(RSTexturePool *pool, RSPooledTexture *entry)
+{
+    if (entry->texture) {
+        SDL_DestroyTexture(entry->texture);
+    }
+    free(entry->pixels);
+    pool->resident_bytes -= entry->bytes;
+    SDL_memset(entry, 0, sizeof(*entry));
+}
+
+// Frees the least recently used idle entry and returns its now-empty slot
+static RSPooledTexture *rs_texture_pool_evict_oldest(RSTexturePool *pool)
+{
+    RSPooledTexture *oldest = NULL;
+    for (int i = 0; i < RS_TEXTURE_POOL_MAX_ENTRIES; ++i) {
+        RSPooledTexture *entry = &pool->entries[i];
+        if (entry->texture && !entry->in_use &&
+            (!oldest || entry->last_used < oldest->last_used)) {
+            oldest = entry;
+        }
+    }
+    if (oldest) {
+        rs_texture_pool_destroy_entry(pool, oldest);
+        pool->evictions++;
+    }
+    return oldest;
+}
+
+// Drops idle entries until `incoming` more bytes fit the budget. In-use
+// entries are never touched, so the budget is a soft limit.
+static void rs_texture_pool_trim(RSTexturePool *pool, size_t incoming)
+{
+    while (pool->resident_bytes + incoming > pool->budget_bytes &&
+           rs_texture_pool_evict_oldest(pool)) {
+    }
+}
+
+void rs_texture_pool_init(RSTexturePool *pool, SDL_Renderer *renderer, size_t budget_bytes)
+{
+    SDL_memset(pool, 0, sizeof(*pool));
+    pool->renderer = renderer;
+    pool->budget_bytes = budget_bytes;
+}
+
+void rs_texture_pool_shutdown(RSTexturePool *pool)
+{
+    for (int i = 0; i < RS_TEXTURE_POOL_MAX_ENTRIES; ++i) {
+        if (pool->entries[i].texture) {
+            rs_texture_pool_destroy_entry(pool, &pool->entries[i]);
+        }
+    }
+    SDL_memset(pool, 0, sizeof(*pool));
+}
+
+RSPooledTexture *rs_texture_pool_acquire(RSTexturePool *pool, Uint32 format, int width, int height)
+{
+    const Uint64 start = SDL_GetPerformanceCounter();
+    const int class_width = rs_texture_pool_class(width);
+    const int class_height = rs_texture_pool_class(height);
+
+    RSPooledTexture *found = NULL;
+    RSPooledTexture *empty = NULL;
+    for (int i = 0; i < RS_TEXTURE_POOL_MAX_ENTRIES; ++i) {
+        RSPooledTexture *entry = &pool->entries[i];
+        if (!entry->texture) {
+            if (!empty) {
+                empty = entry;
+            }
+            continue;
+        }
+        if (!entry->in_use && entry->format == format &&
+            entry->class_width == class_width && entry->class_height == class_height &&
+            (!found || entry->last_used > found->last_used)) {
+            found = entry; // Most recently used match is the likeliest to be cache-warm
+        }
+    }
+
+    if (found) {
+        pool->hits++;
+    } else {
+        const size_t bytes = (size_t)class_width * (size_t)class_height * SDL_BYTESPERPIXEL(format);
+        rs_texture_pool_trim(pool, bytes);
+        if (!empty) {
+            // Table full: take over the least recently used idle slot
+            empty = rs_texture_pool_evict_oldest(pool);
+            if (!empty) {
+                return NULL;
+            }
+        }
+
+        empty->texture = SDL_CreateTexture(pool->renderer, format, SDL_TEXTUREACCESS_STREAMING,
+                                           class_width, class_height);
+        empty->pixels = malloc(bytes);
+        if (!empty->texture || !empty->pixels) {
+            if (empty->texture) {
+                SDL_DestroyTexture(empty->texture);
+            }
+            free(empty->pixels);
+            SDL_memset(empty, 0, sizeof(*empty));
+            return NULL;
+        }
+        empty->format = format;
+        empty->class_width = class_width;
+        empty->class_height = class_height;
+        empty->bytes = bytes;
+        pool->resident_bytes += bytes;
+        pool->misses++;
+        found = empty;
+    }
+
+    found->in_use = SDL_TRUE;
+    found->width = width;
+    found->height = height;
+    found->last_used = ++pool->tick;
+    pool->requested_bytes += (size_t)width * (size_t)height * SDL_BYTESPERPIXEL(format);
+    pool->in_use_bytes += found->bytes;
+    pool->acquires++;
+    pool->acquire_ms += (double)(SDL_GetPerformanceCounter() - start) /
+                        (double)SDL_GetPerformanceFrequency() * 1000.0;
+    return found;
+}
+
+void rs_texture_pool_release(RSTexturePool *pool, RSPooledTexture *entry)
+{
+    if (!entry || !entry->in_use) {
+        return;
+    }
+
+    pool->requested_bytes -= (size_t)entry->width * (size_t)entry->height * SDL_BYTESPERPIXEL(entry->format);
+    pool->in_use_bytes -= entry->bytes;
+    entry->in_use = SDL_FALSE;
+    entry->last_used = ++pool->tick;
+    rs_texture_pool_trim(pool, 0);
+}
+
+double rs_texture_pool_hit_rate(const RSTexturePool *pool)
+{
+    const Uint64 total = pool->hits + pool->misses;
+    return total ? (double)pool->hits / (double)total : 0.0;
+}
+
+double rs_texture_pool_waste(const RSTexturePool *pool)
+{
+    return pool->in_use_bytes ?
+        1.0 - (double)pool->requested_bytes / (double)pool->in_use_bytes : 0.0;
+}
@@ -0,0 +1,56 @@
+#ifndef RENDER_SUITE_TEXTURE_POOL_H
+#define RENDER_SUITE_TEXTURE_POOL_H
+
+#include <SDL2/SDL.h>
+
+#define RS_TEXTURE_POOL_MAX_ENTRIES 64
+#define RS_TEXTURE_POOL_MIN_CLASS 16 // Smallest edge handed out, in pixels
+
+/*
+ * Streaming textures recycled by (format, power-of-two width, power-of-two
+ * height). Each entry owns a CPU staging buffer of the same size, so a hit
+ * costs neither an SDL_CreateTexture nor a malloc. Released entries stay
+ * resident until the byte budget forces the least recently used ones out.
+ */
+typedef struct {
+    SDL_Texture *texture;
+    Uint32 *pixels;           // `bytes` of staging: class_width x class_height in `format`
+    Uint32 format;
+    int class_width;
+    int class_height;
+    int width;                // Size requested by the current owner
+    int height;
+    size_t bytes;
+    Uint64 last_used;
+    SDL_bool in_use;
+} RSPooledTexture;
+
+typedef struct {
+    SDL_Renderer *renderer;
+    RSPooledTexture entries[RS_TEXTURE_POOL_MAX_ENTRIES];
+    size_t budget_bytes;
+    size_t resident_bytes;    // Every texture the pool holds, idle or not
+    size_t requested_bytes;   // What current owners asked for
+    size_t in_use_bytes;      // What current owners actually got
+    Uint64 tick;
+    Uint64 hits;
+    Uint64 misses;
+    Uint64 evictions;
+    Uint64 acquires;
+    double acquire_ms;
+} RSTexturePool;
+
+void rs_texture_pool_init(RSTexturePool *pool, SDL_Renderer *renderer, size_t budget_bytes);
+void rs_texture_pool_shutdown(RSTexturePool *pool);
+
+// Returns an entry at least width x height, or NULL if SDL could not create
+// one. Only the top-left width x height region belongs to the caller.
+RSPooledTexture *rs_texture_pool_acquire(RSTexturePool *pool, Uint32 format, int width, int height);
+void rs_texture_pool_release(RSTexturePool *pool, RSPooledTexture *entry);
+
+double rs_texture_pool_hit_rate(const RSTexturePool *pool);
+
+// Share of in-use texture memory lost to size-class rounding
+double rs_texture_pool_waste(const RSTexturePool *pool);
+
+#endif /* RENDER_SUITE_TEXTURE_POOL_H */
@@ -0,0 +1,174 @@
+#include "render_suite/vertex_batch.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+#define VERTEX_BATCH_MIN_CAPACITY 256
+
+static SDL_bool rs_vertex_batch_reserve(RSVertexBatch *batch, int vertices, int indices)
+{
+    if (batch->vertex_count + vertices > batch->vertex_capacity) {
+        int capacity = SDL_max(batch->vertex_capacity * 2, VERTEX_BATCH_MIN_CAPACITY);
+        while (capacity < batch->vertex_count + vertices) {
+            capacity *= 2;
+        }
+        SDL_Vertex *grown = realloc(batch->vertices, sizeof(SDL_Vertex) * (size_t)capacity);
+        if (!grown) {
+            return SDL_FALSE;
+        }
+        batch->vertices = grown;
+        batch->vertex_capacity = capacity;
+    }
+
+    if (batch->index_count + indices > batch->index_capacity) {
+        int capacity = SDL_max(batch->index_capacity * 2, VERTEX_BATCH_MIN_CAPACITY);
+        while (capacity < batch->index_count + indices) {
+            capacity *= 2;
+        }
+        int *grown = realloc(batch->indices, sizeof(int) * (size_t)capacity);
+        if (!grown) {
+            return SDL_FALSE;
+        }
+        batch->indices = grown;
+        batch->index_capacity = capacity;
+    }
+    return SDL_TRUE;
+}
+
+static inline void rs_vertex_batch_put(SDL_Vertex *vertex, float x, float y, SDL_Color colour)
+{
+    vertex->position.x = x;
+    vertex->position.y = y;
+    vertex->color = colour;
+    vertex->tex_coord.x = 0.0f;
+    vertex->tex_coord.y = 0.0f;
+}
+
+// Two triangles over vertices base + a, b, c, d (in winding order)
+static inline void rs_vertex_batch_quad_indices(int *out, int base, int a, int b, int c, int d)
+{
+    out[0] = base + a;
+    out[1] = base + b;
+    out[2] = base + c;
+    out[3] = base + a;
+    out[4] = base + c;
+    out[5] = base + d;
+}
+
+void rs_vertex_batch_free(RSVertexBatch *batch)
+{
+    free(batch->vertices);
+    free(batch->indices);
+    SDL_memset(batch, 0, sizeof(*batch));
+}
+
+void rs_vertex_batch_reset(RSVertexBatch *batch)
+{
+    batch->vertex_count = 0;
+    batch->index_count = 0;
+}
+
+void rs_vertex_batch_add_quad(RSVertexBatch *batch, const SDL_FPoint corners[4], const SDL_Color colours[4])
+{
+    if (!rs_vertex_batch_reserve(batch, 4, 6)) {
+        return;
+    }
+
+    const int base = batch->vertex_count;
+    for (int i = 0; i < 4; ++i) {
+        rs_vertex_batch_put(&batch->vertices[base + i], corners[i].x, corners[i].y, colours[i]);
+    }
+    rs_vertex_batch_quad_indices(batch->indices + batch->index_count, base, 0, 1, 2, 3);
+    batch->vertex_count += 4;
+    batch->index_count += 6;
+}
+
+void rs_vertex_batch_add_line(RSVertexBatch *batch,
+                              float x0,
+                              float y0,
+                              float x1,
+                              float y1,
+                              float width,
+                              float feather,
+                              SDL_Color colour)
+{
+    const float dx = x1 - x0;
+    const float dy = y1 - y0;
+    const float length = sqrtf(dx * dx + dy * dy);
+    if (length < 1e-4f) {
+        return;
+    }
+
+    // Unit normal scaled to half the width
+    const float nx = -dy / length;
+    const float ny = dx / length;
+    const float half = width * 0.5f;
+
+    if (feather <= 0.0f) {
+        const SDL_FPoint corners[4] = {
+            {x0 + nx * half, y0 + ny * half},
+            {x0 - nx * half, y0 - ny * half},
+            {x1 - nx * half, y1 - ny * half},
+            {x1 + nx * half, y1 + ny * half},
+        };
+        const SDL_Color colours[4] = {colour, colour, colour, colour};
+        rs_vertex_batch_add_quad(batch, corners, colours);
+        return;
+    }
+
+    if (!rs_vertex_batch_reserve(batch, 8, 18)) {
+        return;
+    }
+
+    // Per end: outer+, inner+, inner-, outer-; the outer ring is transparent
+    const float outer = half + feather;
+    const float offsets[4] = {outer, half, -half, -outer};
+    SDL_Color clear = colour;
+    clear.a = 0;
+
+    const int base = batch->vertex_count;
+    SDL_Vertex *vertex = batch->vertices + base;
+    for (int end = 0; end < 2; ++end) {
+        const float px = end ? x1 : x0;
+        const float py = end ? y1 : y0;
+        for (int i = 0; i < 4; ++i) {
+            rs_vertex_batch_put(vertex++, px + nx * offsets[i], py + ny * offsets[i],
+                                (i == 0 || i == 3) ? clear : colour);
+        }
+    }
+
+    // Fringe strip, core, fringe strip between the two ends
+    int *index = batch->indices + batch->index_count;
+    for (int strip = 0; strip < 3; ++strip) {
+        rs_vertex_batch_quad_indices(index, base, strip, strip + 1, 4 + strip + 1, 4 + strip);
+        index += 6;
+    }
+    batch->vertex_count += 8;
+    batch->index_count += 18;
+}
+
+int rs_vertex_batch_flush(RSVertexBatch *batch,
+                          SDL_Renderer *renderer,
+                          SDL_Texture *texture,
+                          BenchMetrics *metrics)
+{
+    if (batch->index_count == 0) {
+        return 0;
+    }
+
+    const int result = SDL_RenderGeometry(renderer,
+                                          texture,
+                                          batch->vertices,
+                                          batch->vertex_count,
+                                          batch->indices,
+                                          batch->index_count);
+    if (metrics) {
+        metrics->draw_calls++;
+        metrics->geometry_batches++;
+        metrics->vertices_rendered += (Uint64)batch->vertex_count;
+        metrics->triangles_rendered += (Uint64)(batch->index_count / 3);
+    }
+
+    rs_vertex_batch_reset(batch);
+    return result;
+}
@@ -0,0 +1,48 @@
+#ifndef RENDER_SUITE_VERTEX_BATCH_H
+#define RENDER_SUITE_VERTEX_BATCH_H
+
+#include <SDL2/SDL.h>
+
+#include "bench_common.h"
+
+/*
+ * Growable indexed SDL_Vertex list submitted with one SDL_RenderGeometry
+ * call. Storage is kept across resets so a steady-state frame allocates
+ * nothing; callers flush once per blend mode / texture.
+ */
+typedef struct {
+    SDL_Vertex *vertices;
+    int *indices;
+    int vertex_count;
+    int index_count;
+    int vertex_capacity;
+    int index_capacity;
+} RSVertexBatch;
+
+void rs_vertex_batch_free(RSVertexBatch *batch);
+void rs_vertex_batch_reset(RSVertexBatch *batch);
+
+// Appends a quad (corners in winding order) as two indexed triangles
+void rs_vertex_batch_add_quad(RSVertexBatch *batch, const SDL_FPoint corners[4], const SDL_Color colours[4]);
+
+/*
+ * Expands a line into a screen-aligned quad `width` pixels across. With
+ * feather > 0 each long edge gets an extra strip fading to zero alpha over
+ * that many pixels, which anti-aliases the edge without MSAA.
+ */
+void rs_vertex_batch_add_line(RSVertexBatch *batch,
+                              float x0,
+                              float y0,
+                              float x1,
+                              float y1,
+                              float width,
+                              float feather,
+                              SDL_Color colour);
+
+// Submits and resets the batch. Returns SDL_RenderGeometry's result.
+int rs_vertex_batch_flush(RSVertexBatch *batch,
+                          SDL_Renderer *renderer,
+                          SDL_Texture *texture,
+                          BenchMetrics *metrics);
+
+#endif /* RENDER_SUITE_VERTEX_BATCH_H */
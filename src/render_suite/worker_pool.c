@@ -0,0 +1,209 @@
+#include "render_suite/worker_pool.h"
+
+#include <SDL2/SDL_mutex.h>
+#include <SDL2/SDL_thread.h>
+
+typedef struct {
+    SDL_mutex *mutex;
+    SDL_cond *work_cond;
+    SDL_cond *done_cond;
+    SDL_Thread *threads[RS_WORKER_POOL_MAX_THREADS];
+    int thread_count;
+    SDL_bool running;
+
+    RSWorkerBandFn fn;
+    void *userdata;
+    int rows;
+    int job_threads;
+    int band_count;
+    int next_band;
+    int bands_done;
+    Uint32 generation;
+    SDL_bool pending;
+    Uint64 submit_counter;
+    Uint64 finish_counter;
+} WorkerPool;
+
+typedef struct {
+    int index;
+} WorkerArgs;
+
+static WorkerPool g_worker_pool = {0};
+
+static int rs_worker_pool_thread(void *userdata)
+{
+    WorkerArgs *args = (WorkerArgs *)userdata;
+    const int index = args->index;
+    SDL_free(args);
+
+    WorkerPool *pool = &g_worker_pool;
+    Uint32 seen_generation = 0;
+
+    SDL_LockMutex(pool->mutex);
+    while (pool->running) {
+        if (pool->generation == seen_generation) {
+            SDL_CondWait(pool->work_cond, pool->mutex);
+            continue;
+        }
+        seen_generation = pool->generation;
+        if (index >= pool->job_threads) {
+            continue;
+        }
+
+        while (pool->next_band < pool->band_count) {
+            const int band = pool->next_band++;
+            const int row_start = (pool->rows * band) / pool->band_count;
+            const int row_end = (pool->rows * (band + 1)) / pool->band_count;
+            RSWorkerBandFn fn = pool->fn;
+            void *job_data = pool->userdata;
+
+            SDL_UnlockMutex(pool->mutex);
+            fn(job_data, row_start, row_end);
+            SDL_LockMutex(pool->mutex);
+
+            pool->bands_done++;
+            if (pool->bands_done == pool->band_count) {
+                pool->finish_counter = SDL_GetPerformanceCounter();
+                SDL_CondBroadcast(pool->done_cond);
+            }
+        }
+    }
+    SDL_UnlockMutex(pool->mutex);
+    return 0;
+}
+
+SDL_bool rs_worker_pool_init(int thread_count)
+{
+    rs_worker_pool_shutdown();
+
+    WorkerPool *pool = &g_worker_pool;
+    pool->mutex = SDL_CreateMutex();
+    pool->work_cond = SDL_CreateCond();
+    pool->done_cond = SDL_CreateCond();
+    if (!pool->mutex || !pool->work_cond || !pool->done_cond) {
+        rs_worker_pool_shutdown();
+        return SDL_FALSE;
+    }
+
+    pool->running = SDL_TRUE;
+    const int clamped = SDL_clamp(thread_count, 1, RS_WORKER_POOL_MAX_THREADS);
+    for (int i = 0; i < clamped; ++i) {
+        WorkerArgs *args = (WorkerArgs *)SDL_calloc(1, sizeof(WorkerArgs));
+        if (!args) {
+            break;
+        }
+        args->index = i;
+        pool->threads[i] = SDL_CreateThread(rs_worker_pool_thread, "rs_worker", args);
+        if (!pool->threads[i]) {
+            SDL_free(args);
+            break;
+        }
+        pool->thread_count++;
+    }
+
+    if (pool->thread_count == 0) {
+        rs_worker_pool_shutdown();
+        return SDL_FALSE;
+    }
+    return SDL_TRUE;
+}
+
+void rs_worker_pool_shutdown(void)
+{
+    WorkerPool *pool = &g_worker_pool;
+
+    if (pool->mutex) {
+        rs_worker_pool_wait(NULL, NULL);
+        SDL_LockMutex(pool->mutex);
+        pool->running = SDL_FALSE;
+        if (pool->work_cond) {
+            SDL_CondBroadcast(pool->work_cond);
+        }
+        SDL_UnlockMutex(pool->mutex);
+    }
+
+    for (int i = 0; i < pool->thread_count; ++i) {
+        SDL_WaitThread(pool->threads[i], NULL);
+    }
+
+    if (pool->done_cond) {
+        SDL_DestroyCond(pool->done_cond);
+    }
+    if (pool->work_cond) {
+        SDL_DestroyCond(pool->work_cond);
+    }
+    if (pool->mutex) {
+        SDL_DestroyMutex(pool->mutex);
+    }
+    SDL_memset(pool, 0, sizeof(*pool));
+}
+
+int rs_worker_pool_thread_count(void)
+{
+    return g_worker_pool.thread_count;
+}
+
+SDL_bool rs_worker_pool_submit(RSWorkerBandFn fn, void *userdata, int rows, int threads)
+{
+    WorkerPool *pool = &g_worker_pool;
+    if (!fn || rows <= 0) {
+        return SDL_FALSE;
+    }
+
+    // No workers: run inline so callers never have to special-case it
+    if (pool->thread_count == 0) {
+        pool->submit_counter = SDL_GetPerformanceCounter();
+        fn(userdata, 0, rows);
+        pool->finish_counter = SDL_GetPerformanceCounter();
+        pool->pending = SDL_TRUE;
+        return SDL_TRUE;
+    }
+
+    rs_worker_pool_wait(NULL, NULL);
+
+    SDL_LockMutex(pool->mutex);
+    pool->fn = fn;
+    pool->userdata = userdata;
+    pool->rows = rows;
+    pool->job_threads = SDL_clamp(threads, 1, pool->thread_count);
+    pool->band_count = SDL_min(rows, RS_WORKER_POOL_BANDS);
+    pool->next_band = 0;
+    pool->bands_done = 0;
+    pool->pending = SDL_TRUE;
+    pool->submit_counter = SDL_GetPerformanceCounter();
+    pool->generation++;
+    SDL_CondBroadcast(pool->work_cond);
+    SDL_UnlockMutex(pool->mutex);
+    return SDL_TRUE;
+}
+
+SDL_bool rs_worker_pool_pending(void)
+{
+    return g_worker_pool.pending;
+}
+
+double rs_worker_pool_wait(Uint64 *submit_counter, Uint64 *finish_counter)
+{
+    WorkerPool *pool = &g_worker_pool;
+    if (!pool->pending) {
+        return 0.0;
+    }
+
+    if (pool->mutex) {
+        SDL_LockMutex(pool->mutex);
+        while (pool->bands_done < pool->band_count) {
+            SDL_CondWait(pool->done_cond, pool->mutex);
+        }
+        SDL_UnlockMutex(pool->mutex);
+    }
+    pool->pending = SDL_FALSE;
+
+    if (submit_counter) {
+        *submit_counter = pool->submit_counter;
+    }
+    if (finish_counter) {
+        *finish_counter = pool->finish_counter;
+    }
+    return (double)(pool->finish_counter - pool->submit_counter) /
+           (double)SDL_GetPerformanceFrequency() * 1000.0;
+}
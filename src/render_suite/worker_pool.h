@@ -0,0 +1,27 @@
+#ifndef RENDER_SUITE_WORKER_POOL_H
+#define RENDER_SUITE_WORKER_POOL_H
+
+#include <SDL2/SDL.h>
+
+#define RS_WORKER_POOL_MAX_THREADS 4
+#define RS_WORKER_POOL_BANDS 8 // Bands per job, grabbed dynamically by workers
+
+typedef void (*RSWorkerBandFn)(void *userdata, int row_start, int row_end);
+
+SDL_bool rs_worker_pool_init(int thread_count);
+void rs_worker_pool_shutdown(void);
+int rs_worker_pool_thread_count(void);
+
+/*
+ * Splits rows into bands and hands them to the first `threads` workers.
+ * Returns immediately; only one job may be in flight at a time.
+ */
+SDL_bool rs_worker_pool_submit(RSWorkerBandFn fn, void *userdata, int rows, int threads);
+
+SDL_bool rs_worker_pool_pending(void);
+
+// Blocks until the in-flight job is done. Returns its wall time in ms and
+// optionally the submit/finish performance counters.
+double rs_worker_pool_wait(Uint64 *submit_counter, Uint64 *finish_counter);
+
+#endif /* RENDER_SUITE_WORKER_POOL_H */
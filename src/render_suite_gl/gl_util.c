@@ -0,0 +1,148 @@
+#include "render_suite_gl/gl_util.h"
+
+#include <SDL2/SDL_log.h>
+
+Uint32 rsgl_gl_compile(GLenum type, const char *source)
+{
+    Uint32 shader = glCreateShader(type);
+    if (!shader) {
+        return 0;
+    }
+    glShaderSource(shader, 1, &source, NULL);
+    glCompileShader(shader);
+
+    GLint status = GL_FALSE;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &status);
+    if (status != GL_TRUE) {
+        char log[256];
+        GLsizei len = 0;
+        glGetShaderInfoLog(shader, sizeof(log) - 1, &len, log);
+        log[len] = '\0';
+        SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+                    "rsgl_gl_compile: shader error %s", log);
+        glDeleteShader(shader);
+        return 0;
+    }
+    return shader;
+}
+
+Uint32 rsgl_gl_link(Uint32 vs, Uint32 fs)
+{
+    Uint32 program = glCreateProgram();
+    if (!program) {
+        return 0;
+    }
+    glAttachShader(program, vs);
+    glAttachShader(program, fs);
+    glBindAttribLocation(program, RSGL_POSITION_LOC, "a_position");
+    glBindAttribLocation(program, RSGL_TEXCOORD_LOC, "a_uv");
+    glLinkProgram(program);
+
+    GLint status = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &status);
+    if (status != GL_TRUE) {
+        char log[256];
+        GLsizei len = 0;
+        glGetProgramInfoLog(program, sizeof(log) - 1, &len, log);
+        log[len] = '\0';
+        SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+                    "rsgl_gl_link: program error %s", log);
+        glDeleteProgram(program);
+        return 0;
+    }
+    glDetachShader(program, vs);
+    glDetachShader(program, fs);
+    return program;
+}
+
+Uint32 rsgl_gl_build(const char *vertex_src, const char *fragment_src)
+{
+    Uint32 vs = rsgl_gl_compile(GL_VERTEX_SHADER, vertex_src);
+    if (!vs) {
+        return 0;
+    }
+    Uint32 program = 0;
+    Uint32 fs = rsgl_gl_compile(GL_FRAGMENT_SHADER, fragment_src);
+    if (fs) {
+        program = rsgl_gl_link(vs, fs);
+        glDeleteShader(fs);
+    }
+    glDeleteShader(vs);
+    return program;
+}
+
+void rsgl_gl_draw_quad(Uint32 vbo, Uint32 ibo, int index_count)
+{
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo);
+
+    glEnableVertexAttribArray(RSGL_POSITION_LOC);
+    glVertexAttribPointer(RSGL_POSITION_LOC,
+                          2,
+                          GL_FLOAT,
+                          GL_FALSE,
+                          sizeof(GLfloat) * 4,
+                          (const void *)0);
+
+    glEnableVertexAttribArray(RSGL_TEXCOORD_LOC);
+    glVertexAttribPointer(RSGL_TEXCOORD_LOC,
+                          2,
+                          GL_FLOAT,
+                          GL_FALSE,
+                          sizeof(GLfloat) * 4,
+                          (const void *)(sizeof(GLfloat) * 2));
+
+    glDrawElements(GL_TRIANGLES, (GLsizei)index_count, GL_UNSIGNED_SHORT, (const void *)0);
+
+    glDisableVertexAttribArray(RSGL_TEXCOORD_LOC);
+    glDisableVertexAttribArray(RSGL_POSITION_LOC);
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+}
+
+double rsgl_gl_elapsed_ms(Uint64 start, Uint64 end)
+{
+    return (double)(end - start) / (double)SDL_GetPerformanceFrequency() * 1000.0;
+}
+
+// Solves a * x = b in place by Gaussian elimination with partial pivoting
+SDL_bool rsgl_solve_linear(double *a, double *b, double *x, int n)
+{
+    for (int col = 0; col < n; ++col) {
+        int pivot = col;
+        for (int row = col + 1; row < n; ++row) {
+            if (SDL_fabs(a[row * n + col]) > SDL_fabs(a[pivot * n + col])) {
+                pivot = row;
+            }
+        }
+        if (SDL_fabs(a[pivot * n + col]) < 1e-12) {
+            return SDL_FALSE;
+        }
+        if (pivot != col) {
+            for (int k = 0; k < n; ++k) {
+                const double tmp = a[col * n + k];
+                a[col * n + k] = a[pivot * n + k];
+                a[pivot * n + k] = tmp;
+            }
+            const double tmp = b[col];
+            b[col] = b[pivot];
+            b[pivot] = tmp;
+        }
+        for (int row = col + 1; row < n; ++row) {
+            const double factor = a[row * n + col] / a[col * n + col];
+            for (int k = col; k < n; ++k) {
+                a[row * n + k] -= factor * a[col * n + k];
+            }
+            b[row] -= factor * b[col];
+        }
+    }
+    for (int row = n - 1; row >= 0; --row) {
+        double sum = b[row];
+        for (int k = row + 1; k < n; ++k) {
+            sum -= a[row * n + k] * x[k];
+        }
+        x[row] = sum / a[row * n + row];
+    }
+    return SDL_TRUE;
+}
@@ -0,0 +1,24 @@
+#ifndef RENDER_SUITE_GL_GL_UTIL_H
+#define RENDER_SUITE_GL_GL_UTIL_H
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_opengles2.h>
+
+#define RSGL_POSITION_LOC 0
+#define RSGL_TEXCOORD_LOC 1
+#define RSGL_QUAD_INDEX_COUNT 6 // Two triangles over the shared full-screen quad
+
+// Shader helpers shared by every GL scene. All of them expect GL to be current.
+Uint32 rsgl_gl_compile(GLenum type, const char *source);
+Uint32 rsgl_gl_link(Uint32 vs, Uint32 fs); // Binds a_position/a_uv to the locations above
+Uint32 rsgl_gl_build(const char *vertex_src, const char *fragment_src);
+
+// Draws `index_count` indices from an interleaved x, y, u, v buffer pair
+void rsgl_gl_draw_quad(Uint32 vbo, Uint32 ibo, int index_count);
+
+double rsgl_gl_elapsed_ms(Uint64 start, Uint64 end);
+
+// Solves the n x n row-major system a * x = b for the cost fits; a and b are overwritten
+SDL_bool rsgl_solve_linear(double *a, double *b, double *x, int n);
+
+#endif /* RENDER_SUITE_GL_GL_UTIL_H */
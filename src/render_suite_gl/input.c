@@ -29,6 +29,45 @@ SDL_bool rsgl_handle_input(RsglState *state, BenchMetrics *metrics)
                 case BTN_X:
                     rsgl_state_cycle_fbo_size(state);
                     break;
+                case BTN_B:
+                    state->readback_mode = (state->readback_mode + 1) % RSGL_READBACK_MODE_MAX;
+                    break;
+                case BTN_L1:
+                    state->alu_running = !state->alu_running;
+                    state->alu_cell = 0;
+                    state->overlay_texfmt = SDL_FALSE;
+                    break;
+                case BTN_DOWN:
+                    state->texfmt_running = !state->texfmt_running;
+                    state->texfmt_cell = 0;
+                    state->overlay_texfmt = SDL_TRUE;
+                    break;
+                case BTN_L2:
+                    state->stage_timing = !state->stage_timing;
+                    break;
+                case BTN_R1:
+                    state->postfx_enabled = !state->postfx_enabled;
+                    break;
+                case BTN_LEFT:
+                    state->postfx_param = (state->postfx_param + 1) % RSGL_POSTFX_PARAM_MAX;
+                    break;
+                case BTN_RIGHT:
+                    // One parameter at a time, so each cost can be told apart from the others
+                    switch (state->postfx_param) {
+                        case RSGL_POSTFX_PARAM_DOWNSAMPLES:
+                            state->postfx_downsamples = state->postfx_downsamples % RSGL_POSTFX_DOWNSAMPLES_MAX + 1;
+                            break;
+                        case RSGL_POSTFX_PARAM_SCALE:
+                            state->postfx_scale = state->postfx_scale % RSGL_POSTFX_SCALES + 1;
+                            break;
+                        default:
+                            state->postfx_kernel = (state->postfx_kernel + 1) % RSGL_POSTFX_KERNELS;
+                            break;
+                    }
+                    break;
+                case BTN_R2:
+                    state->stream_mode = (state->stream_mode + 1) % RSGL_STREAM_MODE_MAX;
+                    break;
                 case BTN_SELECT:
                     bench_reset_metrics(metrics);
                     break;
@@ -8,10 +8,15 @@
 #include "bench_common.h"
 #include "render_suite_gl/input.h"
 #include "render_suite_gl/overlay.h"
+#include "render_suite_gl/scenes/alu_matrix.h"
+#include "render_suite_gl/scenes/tex_formats.h"
 #include "render_suite_gl/scenes/effects.h"
 #include "render_suite_gl/state.h"
 #include "common/loading_screen.h"
 
+#define RSGL_HEADLESS_WARMUP_FRAMES 10
+#define RSGL_HEADLESS_FRAMES 120
+
 static void rsgl_print_info(void)
 {
     SDL_version ver;
@@ -23,10 +28,55 @@ static void rsgl_print_info(void)
     printf("============================\n\n");
 }
 
+/*
+ * Stage timing with nothing on screen: every effect at every FBO preset,
+ * read back into a plain buffer with no SDL renderer or texture upload.
+ * With SDL's offscreen driver the GL context sits on an EGL pbuffer, so
+ * this runs without a display.
+ */
+static int rsgl_run_headless(void)
+{
+    RsglState state;
+    rsgl_state_init(&state);
+    state.headless = SDL_TRUE;
+    state.auto_cycle = SDL_FALSE;
+
+    if (!rsgl_effects_init(&state, NULL)) {
+        fprintf(stderr, "GL effect initialisation failed\n");
+        rsgl_state_destroy(&state);
+        return 1;
+    }
+    state.effect_count = rsgl_effect_count();
+
+    Uint64 counter = SDL_GetPerformanceCounter();
+    const Uint64 freq = SDL_GetPerformanceFrequency();
+    for (int preset = 0; preset < RSGL_FBO_PRESET_COUNT; ++preset) {
+        rsgl_state_cycle_fbo_size(&state);
+        if (!rsgl_effects_apply_fbo_size(&state, NULL)) {
+            continue;
+        }
+        for (int effect = 0; effect < state.effect_count; ++effect) {
+            state.effect_index = effect;
+            for (int frame = 0; frame < RSGL_HEADLESS_WARMUP_FRAMES + RSGL_HEADLESS_FRAMES; ++frame) {
+                state.stage_timing = (frame >= RSGL_HEADLESS_WARMUP_FRAMES) ? SDL_TRUE : SDL_FALSE;
+                rsgl_effects_render_headless(&state, bench_get_delta_seconds(&counter, freq));
+            }
+        }
+        SDL_Log("Headless: %s done", rsgl_fbo_presets[state.fbo_size_index].label);
+    }
+
+    rsgl_effects_cleanup(&state);
+    rsgl_state_destroy(&state);
+    return 0;
+}
+
 int main(int argc, char *argv[])
 {
-    (void)argc;
-    (void)argv;
+    for (int i = 1; i < argc; ++i) {
+        if (SDL_strcmp(argv[i], "--headless") == 0) {
+            SDL_setenv("SDL_VIDEODRIVER", "offscreen", 1);
+        }
+    }
 
     SDL_setenv("SDL_MMIYOO_DOUBLE_BUFFER", "1", 1);
 
@@ -34,6 +84,14 @@ int main(int argc, char *argv[])
         fprintf(stderr, "SDL_Init failed: %s\n", SDL_GetError());
         return 1;
     }
+
+    const char *driver = SDL_GetCurrentVideoDriver();
+    if (driver && SDL_strcmp(driver, "offscreen") == 0) {
+        rsgl_print_info();
+        const int status = rsgl_run_headless();
+        SDL_Quit();
+        return status;
+    }
     if (TTF_Init() < 0) {
         fprintf(stderr, "TTF_Init failed: %s\n", TTF_GetError());
         SDL_Quit();
@@ -67,8 +125,7 @@ int main(int argc, char *argv[])
                                                   window,
                                                   renderer,
                                                   BENCH_LOADING_STYLE_GL);
-    SDL_Window *loader_gl_window = NULL;
-    SDL_GLContext loader_gl_context = NULL;
+    BenchLoadingGL loader_gl;
     if (loading_active) {
         bench_loading_step(&loading, 0.1f, "Preparing state objects");
     }
@@ -105,9 +162,18 @@ int main(int argc, char *argv[])
     rsgl_state_update_layout(&state, overlay);
     if (loading_active) {
         bench_loading_step(&loading, 0.45f, "Preparing GL context");
-        if (bench_loading_obtain_gl(&loading, &loader_gl_window, &loader_gl_context)) {
-            state.gl_window = loader_gl_window;
-            state.gl_context = loader_gl_context;
+        if (bench_loading_obtain_gl_resources(&loading, &loader_gl)) {
+            // The loader's quad matches ours and its FBO becomes ring slot 0,
+            // resized by rsgl_effects_init
+            state.gl_window = loader_gl.window;
+            state.gl_context = loader_gl.context;
+            state.gl_vbo = loader_gl.vbo;
+            state.gl_ibo = loader_gl.ibo;
+            state.gl_fbo[0] = loader_gl.fbo;
+            state.gl_color_texture[0] = loader_gl.color_texture;
+            state.gl_ring_width[0] = loader_gl.width;
+            state.gl_ring_height[0] = loader_gl.height;
+            state.gl_context_reused_ms = loader_gl.context_ms;
             state.gl_external = SDL_TRUE;
             state.gl_library_loaded = SDL_TRUE;
         }
@@ -172,6 +238,8 @@ int main(int argc, char *argv[])
         SDL_RenderClear(renderer);
 
         rsgl_effects_render(&state, renderer, &metrics, delta);
+        rsgl_alu_matrix_step(&state);
+        rsgl_tex_formats_step(&state);
 
         bench_overlay_present(overlay, renderer, &metrics, 0, 0);
         SDL_RenderPresent(renderer);
@@ -3,7 +3,11 @@
 #include <float.h>
 
 #include "common/overlay_grid.h"
+#include "render_suite_gl/scenes/alu_matrix.h"
 #include "render_suite_gl/scenes/effects.h"
+#include "render_suite_gl/scenes/postfx.h"
+#include "render_suite_gl/scenes/stream.h"
+#include "render_suite_gl/scenes/tex_formats.h"
 
 void rsgl_overlay_submit(BenchOverlay *overlay,
                          const RsglState *state,
@@ -20,7 +24,7 @@ void rsgl_overlay_submit(BenchOverlay *overlay,
     const SDL_Color info = {255, 200, 0, 255};
 
     OverlayGrid grid;
-    overlay_grid_init(&grid, 2, 8);
+    overlay_grid_init(&grid, 2, 10);
     overlay_grid_set_background(&grid, (SDL_Color){0, 0, 0, 210});
 
     const int effect_count = state->effect_count;
@@ -35,7 +39,7 @@ void rsgl_overlay_submit(BenchOverlay *overlay,
     }
 
     overlay_grid_set_cell(&grid, 0, 0, accent, 1, "SDL2 GL Effect Suite");
-    overlay_grid_set_cell(&grid, 0, 1, accent, 1, "Controls");
+    overlay_grid_set_cell(&grid, 0, 1, accent, 1, "Controls | START - Back");
 
     overlay_grid_set_cell(&grid, 1, 0, primary, 0,
                           "Effect: %s (%d/%d)",
@@ -63,20 +67,118 @@ void rsgl_overlay_submit(BenchOverlay *overlay,
     overlay_grid_set_cell(&grid, 3, 1, primary, 0,
                           "SELECT - Reset Metrics");
 
-    overlay_grid_set_cell(&grid, 4, 0, green, 0,
-                          "Draw Calls %llu | Texture Updates %llu",
-                          (unsigned long long)metrics->draw_calls,
-                          (unsigned long long)metrics->texture_switches);
+    const int stream_mode = state->stream_drawn_mode;
+    if (stream_mode > RSGL_STREAM_OFF && state->stream_frames[stream_mode] > 0 &&
+        state->stream_frame_ms[stream_mode] > 0.0) {
+        overlay_grid_set_cell(&grid, 4, 0, green, 0,
+                              "Draw Calls %llu | Stream %d verts | submit %.2fms | %.2f Mverts/s",
+                              (unsigned long long)metrics->draw_calls,
+                              state->stream_vertices,
+                              state->stream_submit_last_ms,
+                              (double)state->stream_total_vertices[stream_mode] /
+                                  (state->stream_frame_ms[stream_mode] * 1000.0));
+    } else {
+        overlay_grid_set_cell(&grid, 4, 0, green, 0,
+                              "Draw Calls %llu | Texture Updates %llu",
+                              (unsigned long long)metrics->draw_calls,
+                              (unsigned long long)metrics->texture_switches);
+    }
     overlay_grid_set_cell(&grid, 4, 1, primary, 0,
                           "X - FBO Size %s",
                           fbo_label);
 
     overlay_grid_set_cell(&grid, 5, 0, info, 0,
-                          "Effect Timer %.2fs",
-                          state->elapsed_time);
+                          "Effect Timer %.2fs | Readback %s",
+                          state->elapsed_time,
+                          state->readback_direct ? "Direct" : "Via Buffer");
+
+    overlay_grid_set_cell(&grid, 7, 1, cyan, 0,
+                          "Shader %.1fms %s | Saved %.0fms",
+                          state->shader_ms[effect_index],
+                          state->shader_cached[effect_index] ? "cached" :
+                              (state->shader_cache_supported ? "compiled" : "no cache"),
+                          state->shader_saved_ms);
+
+    const double immediate_ms = rsgl_readback_avg_ms(state, RSGL_READBACK_IMMEDIATE);
+    overlay_grid_set_cell(&grid, 5, 1, primary, 0,
+                          "B - Readback %s",
+                          rsgl_readback_name(state->readback_mode));
+    overlay_grid_set_cell(&grid, 7, 0, green, 0,
+                          "Read ms Imm %.2f | Ring2 %.2f | Ring3 %.2f | Fin %.2f+%.2f",
+                          immediate_ms,
+                          rsgl_readback_avg_ms(state, RSGL_READBACK_RING2),
+                          rsgl_readback_avg_ms(state, RSGL_READBACK_RING3),
+                          state->readback_runs[RSGL_READBACK_FINISH] ?
+                              state->finish_ms / (double)state->readback_runs[RSGL_READBACK_FINISH] : 0.0,
+                          rsgl_readback_avg_ms(state, RSGL_READBACK_FINISH));
+    if (state->stage_timing) {
+        overlay_grid_set_cell(&grid, 6, 0, cyan, 0,
+                              "Stage ms submit %.2f | gpu %.2f (%s) | read %.2f | upload %.2f",
+                              state->stage_last_ms[RSGL_STAGE_SUBMIT],
+                              state->stage_last_ms[RSGL_STAGE_GPU],
+                              state->stage_fence ? "fence" : "finish",
+                              state->stage_last_ms[RSGL_STAGE_READBACK],
+                              state->stage_last_ms[RSGL_STAGE_UPLOAD]);
+    } else if ((state->readback_mode == RSGL_READBACK_RING2 || state->readback_mode == RSGL_READBACK_RING3) &&
+               state->readback_runs[RSGL_READBACK_IMMEDIATE] && state->readback_runs[state->readback_mode]) {
+        overlay_grid_set_cell(&grid, 6, 0, green, 0,
+                              "Stall saved %.2fms/frame",
+                              immediate_ms - rsgl_readback_avg_ms(state, state->readback_mode));
+    }
+    overlay_grid_set_cell(&grid, 6, 1, primary, 0,
+                          "L2 - Stage Timing %s",
+                          state->stage_timing ? "ON" : "OFF");
 
-    overlay_grid_set_cell(&grid, 6, 0, cyan, 0,
-                          "Back - START/ESC");
+    RsglPostfxConfig postfx;
+    if (rsgl_postfx_config(state->postfx_drawn_config, &postfx)) {
+        overlay_grid_set_cell(&grid, 8, 0, green, 0,
+                              "PostFX %d passes | %d down | %d taps | %dx | %.2f Mpx/frame",
+                              state->postfx_passes,
+                              postfx.downsamples,
+                              postfx.taps,
+                              postfx.scale,
+                              (double)state->postfx_pixels / 1000000.0);
+    }
+    overlay_grid_set_cell(&grid, 8, 1, primary, 0,
+                          "R1 PostFX %s | L/R %s | R2 Stream %s",
+                          state->postfx_enabled ? "On" : "Off",
+                          rsgl_postfx_param_name(state->postfx_param),
+                          rsgl_stream_name(state->stream_mode));
+
+    if (state->overlay_texfmt) {
+        const int full = rsgl_tex_formats_fastest(state, 0);
+        const int sub = rsgl_tex_formats_fastest(state, 1);
+        if (state->texfmt_running) {
+            overlay_grid_set_cell(&grid, 9, 0, info, 0,
+                                  "Texture upload %d/%d cells",
+                                  state->texfmt_cell,
+                                  rsgl_tex_formats_cells());
+        } else if (full >= 0 && sub >= 0) {
+            overlay_grid_set_cell(&grid, 9, 0, info, 0,
+                                  "Fastest upload full %s %.2fms | sub %s %.2fms",
+                                  rsgl_tex_formats_name(full),
+                                  state->texfmt_convert_ms[full][0] + state->texfmt_latency_ms[full][0],
+                                  rsgl_tex_formats_name(sub),
+                                  state->texfmt_convert_ms[sub][1] + state->texfmt_latency_ms[sub][1]);
+        }
+    } else if (state->alu_running) {
+        overlay_grid_set_cell(&grid, 9, 0, info, 0,
+                              "ALU matrix %d/%d cells",
+                              state->alu_cell,
+                              rsgl_alu_matrix_cells());
+    } else if (state->alu_fitted) {
+        overlay_grid_set_cell(&grid, 9, 0, info, 0,
+                              "ns/px base %.2f | alu %.3f | tex %.3f | trans %.3f | dep %.3f",
+                              state->alu_cost_ns[0],
+                              state->alu_cost_ns[1 + RSGL_ALU_OP_ALU],
+                              state->alu_cost_ns[1 + RSGL_ALU_OP_TEX],
+                              state->alu_cost_ns[1 + RSGL_ALU_OP_TRANS],
+                              state->alu_cost_ns[1 + RSGL_ALU_OP_DEP]);
+    }
+    overlay_grid_set_cell(&grid, 9, 1, primary, 0,
+                          "L1 ALU Matrix %s | DOWN Tex Upload %s",
+                          state->alu_running ? "Stop" : "Run",
+                          state->texfmt_running ? "Stop" : "Run");
 
     overlay_grid_submit_to_overlay(&grid, overlay);
 }
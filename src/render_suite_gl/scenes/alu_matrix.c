@@ -0,0 +1,374 @@
+#include "render_suite_gl/scenes/alu_matrix.h"
+
+#include <SDL2/SDL_log.h>
+#include <SDL2/SDL_opengles2.h>
+
+#include "render_suite_gl/gl_util.h"
+
+#define RSGL_ALU_DRAWS 6           // Timed draws per cell, after one untimed warm-up draw
+#define RSGL_ALU_NOISE_SIZE 64
+#define RSGL_ALU_SOURCE_MAX 8192
+#define RSGL_ALU_CSV_NAME "rsgl_alu_matrix.csv"
+#define RSGL_ALU_TERMS (RSGL_ALU_OP_CLASSES + 1)
+
+/*
+ * Op counts per variant. Each class is swept on its own at two counts
+ * against an empty baseline, and one mixed variant checks that the costs
+ * add up, which keeps the least-squares system well conditioned.
+ */
+static const int rsgl_alu_variants[RSGL_ALU_VARIANTS][RSGL_ALU_OP_CLASSES] = {
+    {0, 0, 0, 0},
+    {8, 0, 0, 0},
+    {32, 0, 0, 0},
+    {0, 2, 0, 0},
+    {0, 8, 0, 0},
+    {0, 0, 4, 0},
+    {0, 0, 16, 0},
+    {0, 0, 0, 2},
+    {0, 0, 0, 6},
+    {16, 4, 4, 2}
+};
+
+static const char *rsgl_alu_class_names[RSGL_ALU_OP_CLASSES] = {
+    "alu",
+    "tex",
+    "trans",
+    "dep"
+};
+
+static const char *rsgl_alu_vertex_src =
+    "attribute vec2 a_position;\n"
+    "attribute vec2 a_uv;\n"
+    "varying vec2 v_uv;\n"
+    "void main() {\n"
+    "    gl_Position = vec4(a_position, 0.0, 1.0);\n"
+    "    v_uv = a_uv;\n"
+    "}\n";
+
+typedef struct {
+    SDL_bool created;
+    SDL_bool failed;               // Something could not be built; no sweep runs until cleanup
+    Uint32 fbo;
+    Uint32 color_texture;          // Sized for the largest preset, smaller ones use a viewport
+    Uint32 noise_texture;
+    Uint32 programs[RSGL_ALU_VARIANTS];
+    int uniform_time[RSGL_ALU_VARIANTS];
+} RsglAluMatrix;
+
+static RsglAluMatrix g_alu;
+
+int rsgl_alu_matrix_cells(void)
+{
+    return RSGL_ALU_VARIANTS * RSGL_FBO_PRESET_COUNT;
+}
+
+static void rsgl_alu_append(char *dst, size_t size, const char *line, int count)
+{
+    for (int i = 0; i < count; ++i) {
+        SDL_strlcat(dst, line, size);
+    }
+}
+
+/*
+ * Every op feeds `acc`, which reaches gl_FragColor, so none of them can be
+ * folded away. u_time keeps the starting value unknown at compile time.
+ */
+static void rsgl_alu_generate(char *dst, size_t size, const int counts[RSGL_ALU_OP_CLASSES])
+{
+    SDL_strlcpy(dst,
+                "precision mediump float;\n"
+                "varying vec2 v_uv;\n"
+                "uniform sampler2D u_noise;\n"
+                "uniform float u_time;\n"
+                "void main() {\n"
+                "    vec4 acc = vec4(v_uv, u_time, 1.0);\n",
+                size);
+    // The swizzled operand stops a run of multiply-adds collapsing into one
+    rsgl_alu_append(dst, size, "    acc = acc * acc.wzyx + v_uv.xyxy;\n", counts[RSGL_ALU_OP_ALU]);
+    for (int i = 0; i < counts[RSGL_ALU_OP_TEX]; ++i) {
+        // Distinct offsets so the fetches cannot be merged into one
+        char line[96];
+        SDL_snprintf(line, sizeof(line),
+                     "    acc += texture2D(u_noise, v_uv + vec2(%d.0 * 0.013, %d.0 * 0.007));\n",
+                     i + 1, i + 1);
+        SDL_strlcat(dst, line, size);
+    }
+    rsgl_alu_append(dst, size, "    acc = sin(acc);\n", counts[RSGL_ALU_OP_TRANS]);
+    rsgl_alu_append(dst, size, "    acc = texture2D(u_noise, acc.xy);\n", counts[RSGL_ALU_OP_DEP]);
+    SDL_strlcat(dst,
+                "    gl_FragColor = acc;\n"
+                "}\n",
+                size);
+}
+
+static Uint32 rsgl_alu_program(int variant)
+{
+    if (g_alu.programs[variant]) {
+        return g_alu.programs[variant];
+    }
+
+    char *source = (char *)SDL_malloc(RSGL_ALU_SOURCE_MAX);
+    if (!source) {
+        return 0;
+    }
+    rsgl_alu_generate(source, RSGL_ALU_SOURCE_MAX, rsgl_alu_variants[variant]);
+    const Uint32 program = rsgl_gl_build(rsgl_alu_vertex_src, source);
+    SDL_free(source);
+    if (!program) {
+        return 0;
+    }
+
+    glUseProgram(program);
+    glUniform1i(glGetUniformLocation(program, "u_noise"), 0);
+    glUseProgram(0);
+    g_alu.uniform_time[variant] = glGetUniformLocation(program, "u_time");
+    g_alu.programs[variant] = program;
+    return program;
+}
+
+static SDL_bool rsgl_alu_create_targets(void)
+{
+    if (g_alu.created) {
+        return SDL_TRUE;
+    }
+
+    Uint32 noise[RSGL_ALU_NOISE_SIZE * RSGL_ALU_NOISE_SIZE];
+    Uint32 seed = 0x2545F491u;
+    for (int i = 0; i < RSGL_ALU_NOISE_SIZE * RSGL_ALU_NOISE_SIZE; ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        noise[i] = seed;
+    }
+
+    glGenTextures(1, &g_alu.noise_texture);
+    glBindTexture(GL_TEXTURE_2D, g_alu.noise_texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, RSGL_ALU_NOISE_SIZE, RSGL_ALU_NOISE_SIZE, 0,
+                 GL_RGBA, GL_UNSIGNED_BYTE, noise);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+
+    const RsglFboPreset *largest = &rsgl_fbo_presets[RSGL_FBO_PRESET_COUNT - 1];
+    glGenTextures(1, &g_alu.color_texture);
+    glBindTexture(GL_TEXTURE_2D, g_alu.color_texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, largest->width, largest->height, 0,
+                 GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    glGenFramebuffers(1, &g_alu.fbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, g_alu.fbo);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, g_alu.color_texture, 0);
+    const GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    if (status != GL_FRAMEBUFFER_COMPLETE) {
+        SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+                    "rsgl_alu_create_targets: framebuffer incomplete (0x%04x)",
+                    status);
+        return SDL_FALSE;
+    }
+    g_alu.created = SDL_TRUE;
+    return SDL_TRUE;
+}
+
+/*
+ * Per variant, the slope of draw time against pixel count across the
+ * presets is its ns/pixel with fixed per-draw overhead removed. Those
+ * slopes are then fitted against the op counts by least squares.
+ */
+static void rsgl_alu_fit(RsglState *state)
+{
+    for (int v = 0; v < RSGL_ALU_VARIANTS; ++v) {
+        double mean_x = 0.0;
+        double mean_y = 0.0;
+        for (int p = 0; p < RSGL_FBO_PRESET_COUNT; ++p) {
+            mean_x += (double)rsgl_fbo_presets[p].width * (double)rsgl_fbo_presets[p].height;
+            mean_y += state->alu_ms[v][p];
+        }
+        mean_x /= RSGL_FBO_PRESET_COUNT;
+        mean_y /= RSGL_FBO_PRESET_COUNT;
+
+        double sxy = 0.0;
+        double sxx = 0.0;
+        for (int p = 0; p < RSGL_FBO_PRESET_COUNT; ++p) {
+            const double dx = (double)rsgl_fbo_presets[p].width * (double)rsgl_fbo_presets[p].height - mean_x;
+            sxy += dx * (state->alu_ms[v][p] - mean_y);
+            sxx += dx * dx;
+        }
+        state->alu_ns_per_pixel[v] = sxx > 0.0 ? sxy / sxx * 1000000.0 : 0.0;
+    }
+
+    double normal[RSGL_ALU_TERMS][RSGL_ALU_TERMS];
+    double rhs[RSGL_ALU_TERMS];
+    SDL_memset(normal, 0, sizeof(normal));
+    SDL_memset(rhs, 0, sizeof(rhs));
+    for (int v = 0; v < RSGL_ALU_VARIANTS; ++v) {
+        double features[RSGL_ALU_TERMS] = {1.0};
+        for (int c = 0; c < RSGL_ALU_OP_CLASSES; ++c) {
+            features[c + 1] = (double)rsgl_alu_variants[v][c];
+        }
+        for (int i = 0; i < RSGL_ALU_TERMS; ++i) {
+            for (int j = 0; j < RSGL_ALU_TERMS; ++j) {
+                normal[i][j] += features[i] * features[j];
+            }
+            rhs[i] += features[i] * state->alu_ns_per_pixel[v];
+        }
+    }
+    state->alu_fitted = rsgl_solve_linear(&normal[0][0], rhs, state->alu_cost_ns, RSGL_ALU_TERMS);
+}
+
+double rsgl_alu_matrix_predict_ms(const RsglState *state, const int counts[RSGL_ALU_OP_CLASSES], int pixels)
+{
+    if (!state || !state->alu_fitted || !counts) {
+        return 0.0;
+    }
+    double ns = state->alu_cost_ns[0];
+    for (int c = 0; c < RSGL_ALU_OP_CLASSES; ++c) {
+        ns += state->alu_cost_ns[c + 1] * (double)counts[c];
+    }
+    return SDL_max(0.0, ns) * (double)pixels / 1000000.0;
+}
+
+static void rsgl_alu_export(const RsglState *state)
+{
+    char *base_path = SDL_GetBasePath();
+    char path[512];
+    SDL_snprintf(path, sizeof(path), "%s%s", base_path ? base_path : "", RSGL_ALU_CSV_NAME);
+    SDL_free(base_path);
+
+    SDL_RWops *csv = SDL_RWFromFile(path, "w");
+    if (!csv) {
+        SDL_Log("ALU matrix: could not write %s: %s", path, SDL_GetError());
+        return;
+    }
+
+    static const char header[] = "alu,tex,trans,dep,fbo,pixels,ms_per_draw,predicted_ms\n";
+    SDL_RWwrite(csv, header, 1, sizeof(header) - 1);
+    for (int v = 0; v < RSGL_ALU_VARIANTS; ++v) {
+        const int *counts = rsgl_alu_variants[v];
+        for (int p = 0; p < RSGL_FBO_PRESET_COUNT; ++p) {
+            const int pixels = rsgl_fbo_presets[p].width * rsgl_fbo_presets[p].height;
+            char line[160];
+            SDL_snprintf(line, sizeof(line), "%d,%d,%d,%d,%s,%d,%.4f,%.4f\n",
+                         counts[0], counts[1], counts[2], counts[3],
+                         rsgl_fbo_presets[p].label,
+                         pixels,
+                         state->alu_ms[v][p],
+                         rsgl_alu_matrix_predict_ms(state, counts, pixels));
+            SDL_RWwrite(csv, line, 1, SDL_strlen(line));
+        }
+    }
+    SDL_RWclose(csv);
+    SDL_Log("ALU matrix written to %s", path);
+}
+
+static void rsgl_alu_report(const RsglState *state)
+{
+    if (!state || !state->alu_fitted) {
+        return;
+    }
+
+    for (int v = 0; v < RSGL_ALU_VARIANTS; ++v) {
+        const int *counts = rsgl_alu_variants[v];
+        double predicted = state->alu_cost_ns[0];
+        for (int c = 0; c < RSGL_ALU_OP_CLASSES; ++c) {
+            predicted += state->alu_cost_ns[c + 1] * (double)counts[c];
+        }
+        SDL_Log("ALU %2d alu %2d tex %2d trans %2d dep: %.3f ns/px (model %.3f)",
+                counts[0], counts[1], counts[2], counts[3],
+                state->alu_ns_per_pixel[v],
+                predicted);
+    }
+    SDL_Log("ALU model ns/px: base %.3f | %s %.4f | %s %.4f | %s %.4f | %s %.4f",
+            state->alu_cost_ns[0],
+            rsgl_alu_class_names[0], state->alu_cost_ns[1],
+            rsgl_alu_class_names[1], state->alu_cost_ns[2],
+            rsgl_alu_class_names[2], state->alu_cost_ns[3],
+            rsgl_alu_class_names[3], state->alu_cost_ns[4]);
+}
+
+void rsgl_alu_matrix_step(RsglState *state)
+{
+    if (!state || !state->alu_running || !state->gl_ready) {
+        return;
+    }
+    if (g_alu.failed) {
+        state->alu_running = SDL_FALSE;
+        return;
+    }
+    if (SDL_GL_MakeCurrent(state->gl_window, state->gl_context) != 0) {
+        return;
+    }
+
+    const int cell = SDL_clamp(state->alu_cell, 0, rsgl_alu_matrix_cells() - 1);
+    const int variant = cell / RSGL_FBO_PRESET_COUNT;
+    const int preset = cell % RSGL_FBO_PRESET_COUNT;
+    const Uint32 program = rsgl_alu_create_targets() ? rsgl_alu_program(variant) : 0;
+    if (!program) {
+        SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "rsgl_alu_matrix_step: ALU matrix sweep unavailable");
+        g_alu.failed = SDL_TRUE;
+        state->alu_running = SDL_FALSE;
+        SDL_GL_MakeCurrent(state->gl_window, NULL);
+        return;
+    }
+
+    glBindFramebuffer(GL_FRAMEBUFFER, g_alu.fbo);
+    glViewport(0, 0, rsgl_fbo_presets[preset].width, rsgl_fbo_presets[preset].height);
+    glUseProgram(program);
+    if (g_alu.uniform_time[variant] >= 0) {
+        glUniform1f(g_alu.uniform_time[variant], state->elapsed_time);
+    }
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, g_alu.noise_texture);
+
+    // The warm-up draw absorbs any deferred shader work; finishing drains the effect frame too
+    rsgl_gl_draw_quad(state->gl_vbo, state->gl_ibo, RSGL_QUAD_INDEX_COUNT);
+    glFinish();
+    const Uint64 start = SDL_GetPerformanceCounter();
+    for (int i = 0; i < RSGL_ALU_DRAWS; ++i) {
+        rsgl_gl_draw_quad(state->gl_vbo, state->gl_ibo, RSGL_QUAD_INDEX_COUNT);
+    }
+    glFinish();
+    state->alu_ms[variant][preset] =
+        rsgl_gl_elapsed_ms(start, SDL_GetPerformanceCounter()) / (double)RSGL_ALU_DRAWS;
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glUseProgram(0);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    SDL_GL_MakeCurrent(state->gl_window, NULL);
+
+    // This frame's time includes the sweep, so keep it out of the per-mode frame stats
+    state->postfx_drawn_config = -1;
+    state->stream_drawn_mode = -1;
+    state->alu_cell = cell + 1;
+    if (state->alu_cell >= rsgl_alu_matrix_cells()) {
+        state->alu_running = SDL_FALSE;
+        state->alu_cell = 0;
+        rsgl_alu_fit(state);
+        rsgl_alu_report(state);
+        rsgl_alu_export(state);
+    }
+}
+
+void rsgl_alu_matrix_cleanup(RsglState *state)
+{
+    (void)state;
+
+    for (int i = 0; i < RSGL_ALU_VARIANTS; ++i) {
+        if (g_alu.programs[i]) {
+            glDeleteProgram(g_alu.programs[i]);
+        }
+    }
+    if (g_alu.fbo) {
+        glDeleteFramebuffers(1, &g_alu.fbo);
+    }
+    if (g_alu.color_texture) {
+        glDeleteTextures(1, &g_alu.color_texture);
+    }
+    if (g_alu.noise_texture) {
+        glDeleteTextures(1, &g_alu.noise_texture);
+    }
+    SDL_memset(&g_alu, 0, sizeof(g_alu));
+}
@@ -0,0 +1,29 @@
+#ifndef RENDER_SUITE_GL_SCENES_ALU_MATRIX_H
+#define RENDER_SUITE_GL_SCENES_ALU_MATRIX_H
+
+#include <SDL2/SDL.h>
+
+#include "render_suite_gl/state.h"
+
+typedef enum {
+    RSGL_ALU_OP_ALU = 0,   // vec4 multiply-add
+    RSGL_ALU_OP_TEX,       // texture2D at a coordinate known before the shader runs
+    RSGL_ALU_OP_TRANS,     // vec4 sin
+    RSGL_ALU_OP_DEP        // texture2D at a coordinate taken from the previous result
+} RsglAluOpClass;
+
+/*
+ * Times generated fragment shaders with known op counts at every FBO
+ * preset, one variant x preset cell per frame, then fits
+ * ns/pixel = base + sum(count * cost) over the op classes. The results are
+ * logged and written to rsgl_alu_matrix.csv when the sweep completes.
+ */
+void rsgl_alu_matrix_step(RsglState *state);
+
+// Predicted GPU time for one full-target draw, 0 until the model is fitted
+double rsgl_alu_matrix_predict_ms(const RsglState *state, const int counts[RSGL_ALU_OP_CLASSES], int pixels);
+
+int rsgl_alu_matrix_cells(void);
+void rsgl_alu_matrix_cleanup(RsglState *state); // GL must be current
+
+#endif /* RENDER_SUITE_GL_SCENES_ALU_MATRIX_H */
@@ -5,8 +5,12 @@
 
 #include <math.h>
 
-#define RSGL_POSITION_LOC 0
-#define RSGL_TEXCOORD_LOC 1
+#include "render_suite_gl/gl_util.h"
+#include "render_suite_gl/timing.h"
+#include "render_suite_gl/scenes/alu_matrix.h"
+#include "render_suite_gl/scenes/postfx.h"
+#include "render_suite_gl/scenes/stream.h"
+#include "render_suite_gl/scenes/tex_formats.h"
 
 static const GLfloat rsgl_quad[] = {
     -1.0f, -1.0f, 0.0f, 0.0f,
@@ -17,12 +21,13 @@ static const GLfloat rsgl_quad[] = {
 
 static const GLushort rsgl_indices[] = {0, 1, 2, 0, 2, 3};
 
+// y is flipped so the FBO holds rows top-down and glReadPixels returns them in SDL order
 static const char *rsgl_vertex_shader_src =
     "attribute vec2 a_position;\n"
     "attribute vec2 a_uv;\n"
     "varying vec2 v_uv;\n"
     "void main() {\n"
-    "    gl_Position = vec4(a_position, 0.0, 1.0);\n"
+    "    gl_Position = vec4(a_position.x, -a_position.y, 0.0, 1.0);\n"
     "    v_uv = a_uv;\n"
     "}\n";
 
@@ -312,93 +317,215 @@ static const char *rsgl_fragment_shaders[RSGL_EFFECT_MAX] = {
     "}\n"
 };
 
+/*
+ * Effects are compiled the first time they are drawn rather than all at
+ * startup. When the driver exposes GL_OES_get_program_binary, linked
+ * programs are kept next to the binary, one file per effect, named by a
+ * hash of both shader sources and the GL vendor/renderer/version strings
+ * so a driver update or shader edit simply misses the cache.
+ */
+typedef enum {
+    RSGL_PROGRAM_PENDING = 0,
+    RSGL_PROGRAM_READY,
+    RSGL_PROGRAM_FAILED
+} RsglProgramStatus;
+
+#define RSGL_BINARY_MAGIC 0x4C475352u // "RSGL"
+#define RSGL_BINARY_MAX_BYTES (4u * 1024u * 1024u) // Far above any real effect binary
+
+typedef struct {
+    Uint32 magic;
+    Uint32 format;
+    Uint32 length;
+    float compile_ms;  // Cold compile + link time, so warm starts can report the saving
+} RsglBinaryHeader;
+
 static Uint32 rsgl_programs[RSGL_EFFECT_MAX];
 static int rsgl_uniform_time[RSGL_EFFECT_MAX];
+static RsglProgramStatus rsgl_program_status[RSGL_EFFECT_MAX];
 static int rsgl_effect_total = 0;
+static Uint32 rsgl_vertex_shader = 0;
+static Uint64 rsgl_driver_hash = 0;
+static PFNGLGETPROGRAMBINARYOESPROC rsgl_get_program_binary = NULL;
+static PFNGLPROGRAMBINARYOESPROC rsgl_program_binary = NULL;
 
-static Uint32 rsgl_compile(GLenum type, const char *source)
+static Uint64 rsgl_hash(Uint64 hash, const char *text)
 {
-    Uint32 shader = glCreateShader(type);
-    if (!shader) {
-        return 0;
+    // FNV-1a
+    for (const unsigned char *p = (const unsigned char *)(text ? text : ""); *p; ++p) {
+        hash ^= *p;
+        hash *= 0x100000001B3ull;
     }
-    glShaderSource(shader, 1, &source, NULL);
-    glCompileShader(shader);
+    return hash;
+}
 
-    GLint status = GL_FALSE;
-    glGetShaderiv(shader, GL_COMPILE_STATUS, &status);
-    if (status != GL_TRUE) {
-        char log[256];
-        GLsizei len = 0;
-        glGetShaderInfoLog(shader, sizeof(log) - 1, &len, log);
-        log[len] = '\0';
-        SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
-                    "rsgl_compile: shader error %s", log);
-        glDeleteShader(shader);
-        return 0;
-    }
-    return shader;
+static void rsgl_binary_path(char *path, size_t size, int index)
+{
+    char *base_path = SDL_GetBasePath();
+    const Uint64 key = rsgl_hash(rsgl_hash(rsgl_driver_hash, rsgl_vertex_shader_src),
+                                 rsgl_fragment_shaders[index]);
+    SDL_snprintf(path, size, "%srsgl_program_%016llx.bin", base_path ? base_path : "",
+                 (unsigned long long)key);
+    SDL_free(base_path);
 }
 
-static Uint32 rsgl_link(Uint32 vs, Uint32 fs)
+// Returns a linked program from the cache, or 0 on a miss or a rejected binary
+static Uint32 rsgl_load_binary(int index, float *compile_ms)
 {
-    Uint32 program = glCreateProgram();
-    if (!program) {
+    if (!rsgl_program_binary) {
         return 0;
     }
-    glAttachShader(program, vs);
-    glAttachShader(program, fs);
-    glBindAttribLocation(program, RSGL_POSITION_LOC, "a_position");
-    glBindAttribLocation(program, RSGL_TEXCOORD_LOC, "a_uv");
-    glLinkProgram(program);
-
-    GLint status = GL_FALSE;
-    glGetProgramiv(program, GL_LINK_STATUS, &status);
-    if (status != GL_TRUE) {
-        char log[256];
-        GLsizei len = 0;
-        glGetProgramInfoLog(program, sizeof(log) - 1, &len, log);
-        log[len] = '\0';
-        SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
-                    "rsgl_link: program error %s", log);
-        glDeleteProgram(program);
+
+    char path[512];
+    rsgl_binary_path(path, sizeof(path), index);
+    SDL_RWops *file = SDL_RWFromFile(path, "rb");
+    if (!file) {
         return 0;
     }
-    glDetachShader(program, vs);
-    glDetachShader(program, fs);
+
+    // Truncated or corrupt caches must not drive the allocation size
+    const Sint64 file_size = SDL_RWsize(file);
+    RsglBinaryHeader header;
+    void *data = NULL;
+    if (file_size > (Sint64)sizeof(header) &&
+        SDL_RWread(file, &header, sizeof(header), 1) == 1 &&
+        header.magic == RSGL_BINARY_MAGIC && header.length > 0 &&
+        header.length <= RSGL_BINARY_MAX_BYTES &&
+        (Sint64)header.length <= file_size - (Sint64)sizeof(header)) {
+        data = SDL_malloc(header.length);
+        if (data && SDL_RWread(file, data, header.length, 1) != 1) {
+            SDL_free(data);
+            data = NULL;
+        }
+    }
+    SDL_RWclose(file);
+    if (!data) {
+        return 0;
+    }
+
+    Uint32 program = glCreateProgram();
+    if (program) {
+        rsgl_program_binary(program, (GLenum)header.format, data, (GLint)header.length);
+        GLint status = GL_FALSE;
+        glGetProgramiv(program, GL_LINK_STATUS, &status);
+        if (status != GL_TRUE) {
+            glDeleteProgram(program);
+            program = 0;
+        }
+    }
+    SDL_free(data);
+    *compile_ms = header.compile_ms;
     return program;
 }
 
-static SDL_bool rsgl_create_programs(void)
+static void rsgl_save_binary(int index, Uint32 program, float compile_ms)
+{
+    if (!rsgl_get_program_binary) {
+        return;
+    }
+
+    GLint length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH_OES, &length);
+    if (length <= 0) {
+        return;
+    }
+    void *data = SDL_malloc((size_t)length);
+    if (!data) {
+        return;
+    }
+
+    RsglBinaryHeader header = {RSGL_BINARY_MAGIC, 0, 0, compile_ms};
+    GLenum format = 0;
+    GLsizei written = 0;
+    rsgl_get_program_binary(program, length, &written, &format, data);
+    header.format = (Uint32)format;
+    header.length = (Uint32)written;
+
+    char path[512];
+    rsgl_binary_path(path, sizeof(path), index);
+    SDL_RWops *file = written > 0 ? SDL_RWFromFile(path, "wb") : NULL;
+    if (file) {
+        SDL_RWwrite(file, &header, sizeof(header), 1);
+        SDL_RWwrite(file, data, (size_t)written, 1);
+        SDL_RWclose(file);
+    }
+    SDL_free(data);
+}
+
+// Compiles the shared vertex shader and looks up the binary cache entry points
+static SDL_bool rsgl_create_programs(RsglState *state)
 {
-    Uint32 vs = rsgl_compile(GL_VERTEX_SHADER, rsgl_vertex_shader_src);
-    if (!vs) {
+    rsgl_vertex_shader = rsgl_gl_compile(GL_VERTEX_SHADER, rsgl_vertex_shader_src);
+    if (!rsgl_vertex_shader) {
         return SDL_FALSE;
     }
 
-    rsgl_effect_total = 0;
-    for (int i = 0; i < RSGL_EFFECT_MAX; ++i) {
-        Uint32 fs = rsgl_compile(GL_FRAGMENT_SHADER, rsgl_fragment_shaders[i]);
-        if (!fs) {
-            continue;
+    rsgl_driver_hash = 0xCBF29CE484222325ull;
+    rsgl_driver_hash = rsgl_hash(rsgl_driver_hash, (const char *)glGetString(GL_VENDOR));
+    rsgl_driver_hash = rsgl_hash(rsgl_driver_hash, (const char *)glGetString(GL_RENDERER));
+    rsgl_driver_hash = rsgl_hash(rsgl_driver_hash, (const char *)glGetString(GL_VERSION));
+
+    rsgl_get_program_binary = NULL;
+    rsgl_program_binary = NULL;
+    GLint formats = 0;
+    if (SDL_GL_ExtensionSupported("GL_OES_get_program_binary")) {
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS_OES, &formats);
+    }
+    if (formats > 0) {
+        rsgl_get_program_binary =
+            (PFNGLGETPROGRAMBINARYOESPROC)SDL_GL_GetProcAddress("glGetProgramBinaryOES");
+        rsgl_program_binary = (PFNGLPROGRAMBINARYOESPROC)SDL_GL_GetProcAddress("glProgramBinaryOES");
+        if (!rsgl_get_program_binary || !rsgl_program_binary) {
+            rsgl_get_program_binary = NULL;
+            rsgl_program_binary = NULL;
         }
-        Uint32 program = rsgl_link(vs, fs);
-        glDeleteShader(fs);
-        if (!program) {
-            continue;
+    }
+    state->shader_cache_supported = rsgl_program_binary ? SDL_TRUE : SDL_FALSE;
+
+    SDL_memset(rsgl_programs, 0, sizeof(rsgl_programs));
+    SDL_memset(rsgl_program_status, 0, sizeof(rsgl_program_status));
+    rsgl_effect_total = RSGL_EFFECT_MAX;
+    return SDL_TRUE;
+}
+
+// Returns the effect's program, building it on first use. GL must be current.
+static Uint32 rsgl_effect_program(RsglState *state, int index)
+{
+    if (rsgl_program_status[index] != RSGL_PROGRAM_PENDING) {
+        return rsgl_programs[index];
+    }
+
+    const Uint64 start = SDL_GetPerformanceCounter();
+    float cold_ms = 0.0f;
+    Uint32 program = rsgl_load_binary(index, &cold_ms);
+    const SDL_bool cached = program ? SDL_TRUE : SDL_FALSE;
+    if (!program) {
+        Uint32 fs = rsgl_gl_compile(GL_FRAGMENT_SHADER, rsgl_fragment_shaders[index]);
+        if (fs) {
+            program = rsgl_gl_link(rsgl_vertex_shader, fs);
+            glDeleteShader(fs);
         }
-        rsgl_programs[rsgl_effect_total] = program;
-        rsgl_uniform_time[rsgl_effect_total] = glGetUniformLocation(program, "u_time");
-        ++rsgl_effect_total;
     }
+    const double elapsed_ms = rsgl_gl_elapsed_ms(start, SDL_GetPerformanceCounter());
 
-    glDeleteShader(vs);
-    if (rsgl_effect_total == 0) {
+    state->shader_ms[index] = elapsed_ms;
+    state->shader_cached[index] = cached;
+    if (!program) {
+        rsgl_program_status[index] = RSGL_PROGRAM_FAILED;
         SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
-                    "rsgl_create_programs: no effects compiled");
-        return SDL_FALSE;
+                    "rsgl_effect_program: %s failed to build", rsgl_effect_names[index]);
+        return 0;
     }
-    return SDL_TRUE;
+
+    if (cached) {
+        state->shader_saved_ms += SDL_max(0.0, (double)cold_ms - elapsed_ms);
+    } else {
+        rsgl_save_binary(index, program, (float)elapsed_ms);
+    }
+    rsgl_programs[index] = program;
+    rsgl_uniform_time[index] = glGetUniformLocation(program, "u_time");
+    rsgl_program_status[index] = RSGL_PROGRAM_READY;
+    return program;
 }
 
 static SDL_bool rsgl_allocate_pixels(RsglState *state)
@@ -431,6 +558,52 @@ static SDL_bool rsgl_allocate_pixels(RsglState *state)
     return SDL_TRUE;
 }
 
+/*
+ * (Re)allocates every ring texture at width x height and attaches it to its
+ * FBO. Returns the first incomplete status, or GL_FRAMEBUFFER_COMPLETE.
+ * All slots are sized even when the mode uses fewer, so switching modes
+ * never reallocates. A slot already at that size, such as the loading
+ * screen's FBO handed over as slot 0, is left as it is.
+ */
+static GLenum rsgl_size_ring(RsglState *state, int width, int height)
+{
+    GLenum result = GL_FRAMEBUFFER_COMPLETE;
+    for (int i = 0; i < RSGL_FBO_RING_MAX; ++i) {
+        glBindFramebuffer(GL_FRAMEBUFFER, state->gl_fbo[i]);
+        if (state->gl_ring_width[i] != width || state->gl_ring_height[i] != height) {
+            glBindTexture(GL_TEXTURE_2D, state->gl_color_texture[i]);
+            glTexImage2D(GL_TEXTURE_2D,
+                         0,
+                         GL_RGBA,
+                         width,
+                         height,
+                         0,
+                         GL_RGBA,
+                         GL_UNSIGNED_BYTE,
+                         NULL);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+            glFramebufferTexture2D(GL_FRAMEBUFFER,
+                                   GL_COLOR_ATTACHMENT0,
+                                   GL_TEXTURE_2D,
+                                   state->gl_color_texture[i],
+                                   0);
+            state->gl_ring_width[i] = width;
+            state->gl_ring_height[i] = height;
+        }
+        const GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+        if (status != GL_FRAMEBUFFER_COMPLETE && result == GL_FRAMEBUFFER_COMPLETE) {
+            result = status;
+        }
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    // Old contents are gone, so nothing in the ring is readable yet
+    state->ring_filled = 0;
+    return result;
+}
+
 static SDL_bool rsgl_create_targets(RsglState *state)
 {
     if (!state) {
@@ -443,39 +616,42 @@ static SDL_bool rsgl_create_targets(RsglState *state)
         return SDL_FALSE;
     }
 
-    glGenBuffers(1, &state->gl_vbo);
-    glBindBuffer(GL_ARRAY_BUFFER, state->gl_vbo);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(rsgl_quad), rsgl_quad, GL_STATIC_DRAW);
+    // Objects handed over by the loading screen are already filled in
+    const Uint64 start = SDL_GetPerformanceCounter();
+    int reused = 0;
+    if (!state->gl_vbo) {
+        glGenBuffers(1, &state->gl_vbo);
+        glBindBuffer(GL_ARRAY_BUFFER, state->gl_vbo);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(rsgl_quad), rsgl_quad, GL_STATIC_DRAW);
+    } else {
+        reused++;
+    }
 
-    glGenBuffers(1, &state->gl_ibo);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, state->gl_ibo);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(rsgl_indices), rsgl_indices, GL_STATIC_DRAW);
+    if (!state->gl_ibo) {
+        glGenBuffers(1, &state->gl_ibo);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, state->gl_ibo);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(rsgl_indices), rsgl_indices, GL_STATIC_DRAW);
+    } else {
+        reused++;
+    }
 
-    glGenTextures(1, &state->gl_color_texture);
-    glBindTexture(GL_TEXTURE_2D, state->gl_color_texture);
-    glTexImage2D(GL_TEXTURE_2D,
-                 0,
-                 GL_RGBA,
-                 width,
-                 height,
-                 0,
-                 GL_RGBA,
-                 GL_UNSIGNED_BYTE,
-                 NULL);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-
-    glGenFramebuffers(1, &state->gl_fbo);
-    glBindFramebuffer(GL_FRAMEBUFFER, state->gl_fbo);
-    glFramebufferTexture2D(GL_FRAMEBUFFER,
-                           GL_COLOR_ATTACHMENT0,
-                           GL_TEXTURE_2D,
-                           state->gl_color_texture,
-                           0);
-
-    GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
-    glBindTexture(GL_TEXTURE_2D, 0);
+    for (int i = 0; i < RSGL_FBO_RING_MAX; ++i) {
+        if (!state->gl_color_texture[i]) {
+            glGenTextures(1, &state->gl_color_texture[i]);
+        } else {
+            reused++;
+        }
+        if (!state->gl_fbo[i]) {
+            glGenFramebuffers(1, &state->gl_fbo[i]);
+        } else {
+            reused++;
+        }
+    }
+    state->gl_slot0_kept = (state->gl_ring_width[0] == width && state->gl_ring_height[0] == height) ?
+        SDL_TRUE : SDL_FALSE;
+    const GLenum status = rsgl_size_ring(state, width, height);
+    state->gl_targets_ms = rsgl_gl_elapsed_ms(start, SDL_GetPerformanceCounter());
+    state->gl_objects_reused = reused;
     glBindBuffer(GL_ARRAY_BUFFER, 0);
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 
@@ -490,14 +666,11 @@ static SDL_bool rsgl_create_targets(RsglState *state)
 
 SDL_bool rsgl_effects_init(RsglState *state, SDL_Renderer *renderer)
 {
-    if (!state || !renderer) {
-        return SDL_FALSE;
-    }
-
-    if (!rsgl_allocate_pixels(state)) {
+    if (!state || (!renderer && !state->headless)) {
         return SDL_FALSE;
     }
 
+    const Uint64 init_start = SDL_GetPerformanceCounter();
     if (!state->gl_library_loaded) {
         SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_ES);
         SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 2);
@@ -549,23 +722,38 @@ SDL_bool rsgl_effects_init(RsglState *state, SDL_Renderer *renderer)
         return SDL_FALSE;
     }
 
-    if (!rsgl_create_programs() || !rsgl_create_targets(state)) {
+    if (!rsgl_create_programs(state) || !rsgl_create_targets(state)) {
         SDL_GL_MakeCurrent(state->gl_window, NULL);
         return SDL_FALSE;
     }
+    rsgl_timing_init(state);
 
     SDL_GL_MakeCurrent(state->gl_window, NULL);
+    state->gl_init_ms = rsgl_gl_elapsed_ms(init_start, SDL_GetPerformanceCounter());
+    if (state->gl_external) {
+        SDL_Log("GL init: %.2fms | targets %.2fms | loading screen context reused (%.2fms) | "
+                "%d objects reused, slot 0 %s",
+                state->gl_init_ms,
+                state->gl_targets_ms,
+                state->gl_context_reused_ms,
+                state->gl_objects_reused,
+                state->gl_slot0_kept ? "kept" : "resized");
+    } else {
+        SDL_Log("GL init: %.2fms | targets %.2fms | own context", state->gl_init_ms, state->gl_targets_ms);
+    }
 
-    state->screen_texture = SDL_CreateTexture(renderer,
-                                              SDL_PIXELFORMAT_ABGR8888,
-                                              SDL_TEXTUREACCESS_STREAMING,
-                                              state->fbo_width,
-                                              state->fbo_height);
-    if (!state->screen_texture) {
-        SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
-                    "rsgl_effects_init: failed to create SDL texture (%s)",
-                    SDL_GetError());
-        return SDL_FALSE;
+    if (renderer) {
+        state->screen_texture = SDL_CreateTexture(renderer,
+                                                  SDL_PIXELFORMAT_ABGR8888,
+                                                  SDL_TEXTUREACCESS_STREAMING,
+                                                  state->fbo_width,
+                                                  state->fbo_height);
+        if (!state->screen_texture) {
+            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+                        "rsgl_effects_init: failed to create SDL texture (%s)",
+                        SDL_GetError());
+            return SDL_FALSE;
+        }
     }
 
     state->gl_ready = SDL_TRUE;
@@ -578,31 +766,106 @@ SDL_bool rsgl_effects_init(RsglState *state, SDL_Renderer *renderer)
     return SDL_TRUE;
 }
 
-static void rsgl_render_effect(RsglState *state)
+static const char *rsgl_readback_names[RSGL_READBACK_MODE_MAX] = {
+    "Immediate",
+    "Ring x2",
+    "Ring x3",
+    "Finish+Read"
+};
+
+static int rsgl_readback_depth(int mode)
+{
+    switch (mode) {
+        case RSGL_READBACK_RING2:
+            return 2;
+        case RSGL_READBACK_RING3:
+            return 3;
+        default:
+            return 1;
+    }
+}
+
+/*
+ * Reads back the oldest frame in the ring. With a depth of one that is the
+ * frame just drawn, so glReadPixels has to wait for the GPU; deeper rings
+ * read a frame submitted one or two frames earlier, which has normally
+ * finished by now. Returns SDL_FALSE while the ring is still filling.
+ */
+static SDL_bool rsgl_read_ring(RsglState *state, int mode, int slot, int width, int height, void *dst,
+                               double *read_ms)
+{
+    const int depth = state->ring_depth;
+    const int read_slot = (slot + 1) % depth;
+    if (state->ring_filled < depth) {
+        return SDL_FALSE;
+    }
+
+    Uint64 start = SDL_GetPerformanceCounter();
+    if (mode == RSGL_READBACK_FINISH) {
+        glFinish();
+        const Uint64 finished = SDL_GetPerformanceCounter();
+        state->finish_ms += rsgl_gl_elapsed_ms(start, finished);
+        start = finished;
+    }
+
+    glBindFramebuffer(GL_FRAMEBUFFER, state->gl_fbo[read_slot]);
+    glReadPixels(0,
+                 0,
+                 width,
+                 height,
+                 GL_RGBA,
+                 GL_UNSIGNED_BYTE,
+                 dst);
+
+    *read_ms = rsgl_gl_elapsed_ms(start, SDL_GetPerformanceCounter());
+    state->readback_ms[mode] += *read_ms;
+    state->readback_runs[mode]++;
+    return SDL_TRUE;
+}
+
+/*
+ * Returns SDL_TRUE when `dst` received a new tightly packed frame. Submit,
+ * GPU and readback times go into `stage_ms`; the GPU wait only happens
+ * with stage timing on, since it defeats the readback ring.
+ */
+static SDL_bool rsgl_render_effect(RsglState *state, void *dst, double stage_ms[RSGL_STAGE_MAX])
 {
     if (!state->gl_ready) {
-        return;
+        return SDL_FALSE;
     }
 
     const int width = state->fbo_width;
     const int height = state->fbo_height;
     if (width <= 0 || height <= 0) {
-        return;
+        return SDL_FALSE;
     }
 
     if (SDL_GL_MakeCurrent(state->gl_window, state->gl_context) != 0) {
-        return;
+        return SDL_FALSE;
     }
 
     const int mode = (state->effect_count > 0) ? (state->effect_index % state->effect_count) : 0;
-    Uint32 program = (state->effect_count > 0) ? rsgl_programs[mode] : 0;
+    Uint32 program = (state->effect_count > 0) ? rsgl_effect_program(state, mode) : 0;
     if (!program) {
         SDL_GL_MakeCurrent(state->gl_window, NULL);
-        return;
+        return SDL_FALSE;
     }
 
-    glBindFramebuffer(GL_FRAMEBUFFER, state->gl_fbo);
-    glViewport(0, 0, width, height);
+    const int readback = SDL_clamp(state->readback_mode, 0, RSGL_READBACK_MODE_MAX - 1);
+    const int depth = rsgl_readback_depth(readback);
+    if (depth != state->ring_depth) {
+        state->ring_depth = depth;
+        state->ring_head = 0;
+        state->ring_filled = 0;
+    }
+    const int slot = state->ring_head;
+
+    const Uint64 submit_start = SDL_GetPerformanceCounter();
+    const SDL_bool postfx = rsgl_postfx_begin(state);
+    if (!postfx) {
+        glBindFramebuffer(GL_FRAMEBUFFER, state->gl_fbo[slot]);
+        glViewport(0, 0, width, height);
+    }
     glClearColor(0.05f, 0.07f, 0.12f, 1.0f);
     glClear(GL_COLOR_BUFFER_BIT);
 
@@ -611,84 +874,77 @@ static void rsgl_render_effect(RsglState *state)
         glUniform1f(rsgl_uniform_time[mode], state->elapsed_time);
     }
 
-    glBindBuffer(GL_ARRAY_BUFFER, state->gl_vbo);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, state->gl_ibo);
-
-    glEnableVertexAttribArray(RSGL_POSITION_LOC);
-    glVertexAttribPointer(RSGL_POSITION_LOC,
-                          2,
-                          GL_FLOAT,
-                          GL_FALSE,
-                          sizeof(GLfloat) * 4,
-                          (const void *)0);
-
-    glEnableVertexAttribArray(RSGL_TEXCOORD_LOC);
-    glVertexAttribPointer(RSGL_TEXCOORD_LOC,
-                          2,
-                          GL_FLOAT,
-                          GL_FALSE,
-                          sizeof(GLfloat) * 4,
-                          (const void *)(sizeof(GLfloat) * 2));
-
-    glDrawElements(GL_TRIANGLES,
-                   (GLsizei)(sizeof(rsgl_indices) / sizeof(rsgl_indices[0])),
-                   GL_UNSIGNED_SHORT,
-                   (const void *)0);
-
-    glDisableVertexAttribArray(RSGL_TEXCOORD_LOC);
-    glDisableVertexAttribArray(RSGL_POSITION_LOC);
-
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    rsgl_gl_draw_quad(state->gl_vbo,
+                      state->gl_ibo,
+                      (int)(sizeof(rsgl_indices) / sizeof(rsgl_indices[0])));
     glUseProgram(0);
+    rsgl_stream_draw(state);
+    if (postfx) {
+        rsgl_postfx_end(state, state->gl_fbo[slot], width, height);
+    }
+    stage_ms[RSGL_STAGE_SUBMIT] = rsgl_gl_elapsed_ms(submit_start, SDL_GetPerformanceCounter());
+    if (state->stage_timing) {
+        stage_ms[RSGL_STAGE_GPU] = rsgl_timing_wait_gpu(state);
+    }
 
-    glReadPixels(0,
-                 0,
-                 width,
-                 height,
-                 GL_RGBA,
-                 GL_UNSIGNED_BYTE,
-                 state->pixel_buffer);
+    if (depth > 1) {
+        // Kick this frame off now so it is done by the time the ring comes back to it
+        glFlush();
+    }
+    state->ring_filled = SDL_min(state->ring_filled + 1, depth);
+    const SDL_bool fresh = rsgl_read_ring(state, readback, slot, width, height, dst,
+                                          &stage_ms[RSGL_STAGE_READBACK]);
+    state->ring_head = (slot + 1) % depth;
 
     glBindFramebuffer(GL_FRAMEBUFFER, 0);
     SDL_GL_MakeCurrent(state->gl_window, NULL);
+    return fresh;
 }
 
-static void rsgl_upload_texture(RsglState *state)
+/*
+ * Reads the effect straight into the locked streaming texture when its rows
+ * are tightly packed, as SDL's streaming buffers normally are for RGBA.
+ * GLES2 cannot read into a wider pitch, so otherwise the frame goes through
+ * pixel_buffer and is copied across row by row.
+ */
+static void rsgl_render_to_texture(RsglState *state)
 {
-    if (!state->screen_texture || !state->pixel_buffer) {
-        return;
-    }
-
     void *pixels = NULL;
     int pitch = 0;
-    if (SDL_LockTexture(state->screen_texture, NULL, &pixels, &pitch) != 0) {
+    if (!state->screen_texture || SDL_LockTexture(state->screen_texture, NULL, &pixels, &pitch) != 0) {
         return;
     }
 
-    Uint8 *dst = (Uint8 *)pixels;
-    const Uint8 *src = state->pixel_buffer;
-    const int width = state->fbo_width;
-    const int height = state->fbo_height;
-    if (width <= 0 || height <= 0) {
+    const int row_bytes = state->fbo_width * 4;
+    const SDL_bool direct = (pitch == row_bytes) ? SDL_TRUE : SDL_FALSE;
+    if (!direct && !rsgl_allocate_pixels(state)) {
         SDL_UnlockTexture(state->screen_texture);
         return;
     }
-
-    const int src_stride = width * 4;
-
-    for (int y = 0; y < height; ++y) {
-        Uint8 *row = dst + y * pitch;
-        const Uint8 *src_row = src + (height - 1 - y) * src_stride;
-        SDL_memcpy(row, src_row, src_stride);
+    state->readback_direct = direct;
+
+    double stage_ms[RSGL_STAGE_MAX] = {0.0};
+    const SDL_bool fresh = rsgl_render_effect(state, direct ? pixels : state->pixel_buffer, stage_ms);
+    const Uint64 upload_start = SDL_GetPerformanceCounter();
+    if (fresh && !direct) {
+        Uint8 *dst = (Uint8 *)pixels;
+        const Uint8 *src = state->pixel_buffer;
+        for (int y = 0; y < state->fbo_height; ++y) {
+            SDL_memcpy(dst + (size_t)y * (size_t)pitch, src + (size_t)y * (size_t)row_bytes, (size_t)row_bytes);
+        }
     }
 
     SDL_UnlockTexture(state->screen_texture);
+    stage_ms[RSGL_STAGE_UPLOAD] = rsgl_gl_elapsed_ms(upload_start, SDL_GetPerformanceCounter());
+
+    if (fresh && state->stage_timing && state->effect_count > 0) {
+        rsgl_timing_record(state, state->effect_index % state->effect_count, stage_ms);
+    }
 }
 
 SDL_bool rsgl_effects_apply_fbo_size(RsglState *state, SDL_Renderer *renderer)
 {
-    if (!state || !renderer) {
+    if (!state || (!renderer && !state->headless)) {
         return SDL_FALSE;
     }
     if (!state->gl_ready) {
@@ -696,13 +952,6 @@ SDL_bool rsgl_effects_apply_fbo_size(RsglState *state, SDL_Renderer *renderer)
         return SDL_TRUE;
     }
 
-    if (!rsgl_allocate_pixels(state)) {
-        SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
-                    "rsgl_effects_apply_fbo_size: pixel allocation failed");
-        rsgl_state_revert_fbo_size(state);
-        return SDL_FALSE;
-    }
-
     const int width = state->fbo_width;
     const int height = state->fbo_height;
     if (width <= 0 || height <= 0) {
@@ -714,12 +963,12 @@ SDL_bool rsgl_effects_apply_fbo_size(RsglState *state, SDL_Renderer *renderer)
         return SDL_FALSE;
     }
 
-    SDL_Texture *new_texture = SDL_CreateTexture(renderer,
-                                                 SDL_PIXELFORMAT_ABGR8888,
-                                                 SDL_TEXTUREACCESS_STREAMING,
-                                                 width,
-                                                 height);
-    if (!new_texture) {
+    SDL_Texture *new_texture = renderer ? SDL_CreateTexture(renderer,
+                                                            SDL_PIXELFORMAT_ABGR8888,
+                                                            SDL_TEXTUREACCESS_STREAMING,
+                                                            width,
+                                                            height) : NULL;
+    if (renderer && !new_texture) {
         SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
                     "rsgl_effects_apply_fbo_size: SDL texture creation failed (%s)",
                     SDL_GetError());
@@ -727,10 +976,12 @@ SDL_bool rsgl_effects_apply_fbo_size(RsglState *state, SDL_Renderer *renderer)
         return SDL_FALSE;
     }
 
-    if (!state->gl_window || !state->gl_context || !state->gl_color_texture || !state->gl_fbo) {
+    if (!state->gl_window || !state->gl_context || !state->gl_color_texture[0] || !state->gl_fbo[0]) {
         SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
                     "rsgl_effects_apply_fbo_size: GL targets not ready");
-        SDL_DestroyTexture(new_texture);
+        if (new_texture) {
+            SDL_DestroyTexture(new_texture);
+        }
         rsgl_state_revert_fbo_size(state);
         return SDL_FALSE;
     }
@@ -739,33 +990,14 @@ SDL_bool rsgl_effects_apply_fbo_size(RsglState *state, SDL_Renderer *renderer)
         SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
                     "rsgl_effects_apply_fbo_size: make current failed (%s)",
                     SDL_GetError());
-        SDL_DestroyTexture(new_texture);
+        if (new_texture) {
+            SDL_DestroyTexture(new_texture);
+        }
         rsgl_state_revert_fbo_size(state);
         return SDL_FALSE;
     }
 
-    glBindTexture(GL_TEXTURE_2D, state->gl_color_texture);
-    glTexImage2D(GL_TEXTURE_2D,
-                 0,
-                 GL_RGBA,
-                 width,
-                 height,
-                 0,
-                 GL_RGBA,
-                 GL_UNSIGNED_BYTE,
-                 NULL);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-
-    glBindFramebuffer(GL_FRAMEBUFFER, state->gl_fbo);
-    glFramebufferTexture2D(GL_FRAMEBUFFER,
-                           GL_COLOR_ATTACHMENT0,
-                           GL_TEXTURE_2D,
-                           state->gl_color_texture,
-                           0);
-    GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
-    glBindTexture(GL_TEXTURE_2D, 0);
+    const GLenum status = rsgl_size_ring(state, width, height);
 
     SDL_GL_MakeCurrent(state->gl_window, NULL);
 
@@ -773,15 +1005,19 @@ SDL_bool rsgl_effects_apply_fbo_size(RsglState *state, SDL_Renderer *renderer)
         SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
                     "rsgl_effects_apply_fbo_size: framebuffer incomplete (0x%04x)",
                     status);
-        SDL_DestroyTexture(new_texture);
+        if (new_texture) {
+            SDL_DestroyTexture(new_texture);
+        }
         rsgl_state_revert_fbo_size(state);
         return SDL_FALSE;
     }
 
-    if (state->screen_texture) {
-        SDL_DestroyTexture(state->screen_texture);
+    if (new_texture) {
+        if (state->screen_texture) {
+            SDL_DestroyTexture(state->screen_texture);
+        }
+        state->screen_texture = new_texture;
     }
-    state->screen_texture = new_texture;
 
     rsgl_state_commit_fbo_size(state);
     return SDL_TRUE;
@@ -796,6 +1032,8 @@ void rsgl_effects_render(RsglState *state,
         return;
     }
 
+    rsgl_postfx_account(state, delta_seconds * 1000.0);
+    rsgl_stream_account(state, delta_seconds * 1000.0);
     state->elapsed_time += (float)delta_seconds;
     if (state->auto_cycle && state->effect_count > 0) {
         const double cycle_time = 10.0;
@@ -804,8 +1042,7 @@ void rsgl_effects_render(RsglState *state,
         }
     }
 
-    rsgl_render_effect(state);
-    rsgl_upload_texture(state);
+    rsgl_render_to_texture(state);
 
     SDL_Rect dst = {
         0,
@@ -817,8 +1054,37 @@ void rsgl_effects_render(RsglState *state,
     SDL_RenderCopy(renderer, state->screen_texture, NULL, &dst);
 
     if (metrics) {
-        metrics->draw_calls += 2; // GL render + SDL copy
+        metrics->draw_calls += state->postfx_passes + 1; // GL passes + SDL copy
         metrics->texture_switches++;
+        metrics->pixel_operations += state->postfx_pixels;
+        if (state->stream_vertices > 0) {
+            metrics->draw_calls++;
+            metrics->vertices_rendered += (Uint64)state->stream_vertices;
+            metrics->triangles_rendered += (Uint64)state->stream_vertices / 2;
+        }
+    }
+}
+
+/*
+ * Headless frame: the effect is read back into pixel_buffer and goes no
+ * further, so the upload stage is recorded as zero and no SDL texture or
+ * renderer is touched.
+ */
+void rsgl_effects_render_headless(RsglState *state, double delta_seconds)
+{
+    if (!state || !state->gl_ready || !rsgl_allocate_pixels(state)) {
+        return;
+    }
+
+    rsgl_postfx_account(state, delta_seconds * 1000.0);
+    rsgl_stream_account(state, delta_seconds * 1000.0);
+    state->elapsed_time += (float)delta_seconds;
+    state->readback_direct = SDL_FALSE;
+
+    double stage_ms[RSGL_STAGE_MAX] = {0.0};
+    if (rsgl_render_effect(state, state->pixel_buffer, stage_ms) &&
+        state->stage_timing && state->effect_count > 0) {
+        rsgl_timing_record(state, state->effect_index % state->effect_count, stage_ms);
     }
 }
 
@@ -830,8 +1096,7 @@ void rsgl_effects_warmup(RsglState *state)
 
     const float saved_time = state->elapsed_time;
     state->elapsed_time = 0.0f;
-    rsgl_render_effect(state);
-    rsgl_upload_texture(state);
+    rsgl_render_to_texture(state);
     state->elapsed_time = saved_time;
 }
 
@@ -841,15 +1106,62 @@ void rsgl_effects_cleanup(RsglState *state)
         return;
     }
 
+    double shader_total_ms = 0.0;
+    for (int i = 0; i < RSGL_EFFECT_MAX; ++i) {
+        if (state->shader_ms[i] <= 0.0) {
+            continue;
+        }
+        shader_total_ms += state->shader_ms[i];
+        SDL_Log("Shader %-16s: %.2fms (%s)",
+                rsgl_effect_names[i],
+                state->shader_ms[i],
+                state->shader_cached[i] ? "binary cache" : "compiled");
+    }
+    if (shader_total_ms > 0.0) {
+        SDL_Log("Shaders: %.2fms total | cache %s | saved %.2fms",
+                shader_total_ms,
+                state->shader_cache_supported ? "on" : "unsupported",
+                state->shader_saved_ms);
+    }
+
+    rsgl_postfx_report(state);
+    rsgl_stream_report(state);
+    rsgl_timing_report(state);
+
+    for (int mode = 0; mode < RSGL_READBACK_MODE_MAX; ++mode) {
+        if (state->readback_runs[mode] == 0) {
+            continue;
+        }
+        const double runs = (double)state->readback_runs[mode];
+        if (mode == RSGL_READBACK_FINISH) {
+            SDL_Log("Readback %-11s: finish %.3fms + read %.3fms (%llu)",
+                    rsgl_readback_names[mode],
+                    state->finish_ms / runs,
+                    state->readback_ms[mode] / runs,
+                    (unsigned long long)state->readback_runs[mode]);
+        } else {
+            SDL_Log("Readback %-11s: read %.3fms (%llu)",
+                    rsgl_readback_names[mode],
+                    state->readback_ms[mode] / runs,
+                    (unsigned long long)state->readback_runs[mode]);
+        }
+    }
+
     if (state->gl_context && state->gl_window) {
         if (SDL_GL_MakeCurrent(state->gl_window, state->gl_context) == 0) {
-            if (state->gl_fbo) {
-                glDeleteFramebuffers(1, &state->gl_fbo);
-                state->gl_fbo = 0;
+            rsgl_postfx_cleanup(state);
+            rsgl_alu_matrix_cleanup(state);
+            rsgl_stream_cleanup(state);
+            rsgl_tex_formats_cleanup(state);
+            if (state->gl_fbo[0]) {
+                glDeleteFramebuffers(RSGL_FBO_RING_MAX, state->gl_fbo);
+                SDL_memset(state->gl_fbo, 0, sizeof(state->gl_fbo));
             }
-            if (state->gl_color_texture) {
-                glDeleteTextures(1, &state->gl_color_texture);
-                state->gl_color_texture = 0;
+            if (state->gl_color_texture[0]) {
+                glDeleteTextures(RSGL_FBO_RING_MAX, state->gl_color_texture);
+                SDL_memset(state->gl_color_texture, 0, sizeof(state->gl_color_texture));
+                SDL_memset(state->gl_ring_width, 0, sizeof(state->gl_ring_width));
+                SDL_memset(state->gl_ring_height, 0, sizeof(state->gl_ring_height));
             }
             if (state->gl_vbo) {
                 glDeleteBuffers(1, &state->gl_vbo);
@@ -864,6 +1176,11 @@ void rsgl_effects_cleanup(RsglState *state)
                     glDeleteProgram(rsgl_programs[i]);
                     rsgl_programs[i] = 0;
                 }
+                rsgl_program_status[i] = RSGL_PROGRAM_PENDING;
+            }
+            if (rsgl_vertex_shader) {
+                glDeleteShader(rsgl_vertex_shader);
+                rsgl_vertex_shader = 0;
             }
             SDL_GL_MakeCurrent(state->gl_window, NULL);
         }
@@ -892,6 +1209,19 @@ int rsgl_effect_count(void)
     return rsgl_effect_total;
 }
 
+const char *rsgl_readback_name(int mode)
+{
+    return rsgl_readback_names[SDL_clamp(mode, 0, RSGL_READBACK_MODE_MAX - 1)];
+}
+
+double rsgl_readback_avg_ms(const RsglState *state, int mode)
+{
+    if (!state || mode < 0 || mode >= RSGL_READBACK_MODE_MAX || state->readback_runs[mode] == 0) {
+        return 0.0;
+    }
+    return state->readback_ms[mode] / (double)state->readback_runs[mode];
+}
+
 const char *rsgl_effect_name(int index)
 {
     if (index < 0 || index >= rsgl_effect_total) {
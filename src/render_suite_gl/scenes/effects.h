@@ -11,10 +11,13 @@ void rsgl_effects_render(RsglState *state,
                          SDL_Renderer *renderer,
                          BenchMetrics *metrics,
                          double delta_seconds);
+void rsgl_effects_render_headless(RsglState *state, double delta_seconds); // Read back only, no SDL upload
 void rsgl_effects_warmup(RsglState *state);
 SDL_bool rsgl_effects_apply_fbo_size(RsglState *state, SDL_Renderer *renderer);
 void rsgl_effects_cleanup(RsglState *state);
 int rsgl_effect_count(void);
 const char *rsgl_effect_name(int index);
+const char *rsgl_readback_name(int mode);
+double rsgl_readback_avg_ms(const RsglState *state, int mode); // glReadPixels only, 0 until measured
 
 #endif /* RENDER_SUITE_GL_SCENES_EFFECTS_H */
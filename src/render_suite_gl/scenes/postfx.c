@@ -0,0 +1,516 @@
+#include "render_suite_gl/scenes/postfx.h"
+
+#include <SDL2/SDL_log.h>
+#include <SDL2/SDL_opengles2.h>
+
+#include <math.h>
+
+#include "render_suite_gl/gl_util.h"
+
+#define RSGL_POSTFX_CHAIN_MAX RSGL_POSTFX_DOWNSAMPLES_MAX
+#define RSGL_POSTFX_RADIUS_MAX 6
+#define RSGL_POSTFX_FIT_TERMS 4      // Base, per pass, per Mpx shaded, per M blur fetches
+#define RSGL_POSTFX_THRESHOLD 0.55f  // Only what is brighter than this feeds the bloom
+#define RSGL_POSTFX_INTENSITY 0.9f
+
+// Target 0 is the scene, then the downsample chain, then the blur scratch buffer
+#define RSGL_POSTFX_SCENE 0
+#define RSGL_POSTFX_CHAIN 1
+#define RSGL_POSTFX_BLUR (RSGL_POSTFX_CHAIN + RSGL_POSTFX_CHAIN_MAX)
+#define RSGL_POSTFX_TARGETS (RSGL_POSTFX_BLUR + 1)
+
+static const int rsgl_postfx_kernel_taps[RSGL_POSTFX_KERNELS] = {5, 9, 13};
+
+static const char *rsgl_postfx_param_names[RSGL_POSTFX_PARAM_MAX] = {
+    "Down",
+    "Scale",
+    "Taps"
+};
+
+// Unlike the effect shader this one does not flip, so the chain keeps the scene's row order
+static const char *rsgl_postfx_vertex_src =
+    "attribute vec2 a_position;\n"
+    "attribute vec2 a_uv;\n"
+    "varying vec2 v_uv;\n"
+    "void main() {\n"
+    "    gl_Position = vec4(a_position, 0.0, 1.0);\n"
+    "    v_uv = a_uv;\n"
+    "}\n";
+
+// Four bilinear taps cover a 4x4 texel box, so each halving reads every source texel
+static const char *rsgl_postfx_downsample_src =
+    "precision mediump float;\n"
+    "varying vec2 v_uv;\n"
+    "uniform sampler2D u_source;\n"
+    "uniform vec2 u_texel;\n"
+    "uniform float u_threshold;\n"
+    "void main() {\n"
+    "    vec3 color = texture2D(u_source, v_uv + vec2(-u_texel.x, -u_texel.y)).rgb;\n"
+    "    color += texture2D(u_source, v_uv + vec2(u_texel.x, -u_texel.y)).rgb;\n"
+    "    color += texture2D(u_source, v_uv + vec2(-u_texel.x, u_texel.y)).rgb;\n"
+    "    color += texture2D(u_source, v_uv + vec2(u_texel.x, u_texel.y)).rgb;\n"
+    "    color = max(color * 0.25 - vec3(u_threshold), vec3(0.0));\n"
+    "    gl_FragColor = vec4(color, 1.0);\n"
+    "}\n";
+
+// Prefixed with "#define RSGL_RADIUS n" so the loop has the constant bound GLSL ES needs
+static const char *rsgl_postfx_blur_src =
+    "precision mediump float;\n"
+    "varying vec2 v_uv;\n"
+    "uniform sampler2D u_source;\n"
+    "uniform vec2 u_step;\n"
+    "uniform float u_weights[RSGL_RADIUS + 1];\n"
+    "void main() {\n"
+    "    vec3 color = texture2D(u_source, v_uv).rgb * u_weights[0];\n"
+    "    for (int i = 1; i <= RSGL_RADIUS; ++i) {\n"
+    "        vec2 offset = u_step * float(i);\n"
+    "        color += (texture2D(u_source, v_uv + offset).rgb +\n"
+    "                  texture2D(u_source, v_uv - offset).rgb) * u_weights[i];\n"
+    "    }\n"
+    "    gl_FragColor = vec4(color, 1.0);\n"
+    "}\n";
+
+static const char *rsgl_postfx_composite_src =
+    "precision mediump float;\n"
+    "varying vec2 v_uv;\n"
+    "uniform sampler2D u_scene;\n"
+    "uniform sampler2D u_bloom;\n"
+    "uniform float u_intensity;\n"
+    "void main() {\n"
+    "    vec3 color = texture2D(u_scene, v_uv).rgb + texture2D(u_bloom, v_uv).rgb * u_intensity;\n"
+    "    gl_FragColor = vec4(color, 1.0);\n"
+    "}\n";
+
+typedef struct {
+    Uint32 program;
+    int step;
+    int weights;
+    float weight_values[RSGL_POSTFX_RADIUS_MAX + 1];
+} RsglPostfxBlur;
+
+typedef struct {
+    SDL_bool created;
+    SDL_bool failed;              // Something could not be built; stays off until cleanup
+    Uint32 fbo[RSGL_POSTFX_TARGETS];
+    Uint32 texture[RSGL_POSTFX_TARGETS];
+    int width[RSGL_POSTFX_TARGETS];
+    int height[RSGL_POSTFX_TARGETS];
+    int sized_config;             // Configuration and FBO size the targets were allocated for
+    int sized_fbo_width;
+    int sized_fbo_height;
+
+    Uint32 downsample_program;
+    int downsample_texel;
+    int downsample_threshold;
+    Uint32 composite_program;
+    int composite_intensity;
+    RsglPostfxBlur blur[RSGL_POSTFX_KERNELS];
+} RsglPostfx;
+
+static RsglPostfx g_postfx;
+
+int rsgl_postfx_config_index(const RsglState *state)
+{
+    if (!state || !state->postfx_enabled) {
+        return 0;
+    }
+    const int downsamples = SDL_clamp(state->postfx_downsamples, 1, RSGL_POSTFX_DOWNSAMPLES_MAX);
+    const int kernel = SDL_clamp(state->postfx_kernel, 0, RSGL_POSTFX_KERNELS - 1);
+    const int scale = SDL_clamp(state->postfx_scale, 1, RSGL_POSTFX_SCALES);
+    return 1 + ((downsamples - 1) * RSGL_POSTFX_KERNELS + kernel) * RSGL_POSTFX_SCALES + (scale - 1);
+}
+
+SDL_bool rsgl_postfx_config(int index, RsglPostfxConfig *config)
+{
+    if (index < 1 || index > RSGL_POSTFX_CONFIGS || !config) {
+        return SDL_FALSE;
+    }
+    const int packed = index - 1;
+    config->scale = packed % RSGL_POSTFX_SCALES + 1;
+    config->taps = rsgl_postfx_kernel_taps[(packed / RSGL_POSTFX_SCALES) % RSGL_POSTFX_KERNELS];
+    config->downsamples = packed / (RSGL_POSTFX_SCALES * RSGL_POSTFX_KERNELS) + 1;
+    return SDL_TRUE;
+}
+
+const char *rsgl_postfx_param_name(int param)
+{
+    return rsgl_postfx_param_names[SDL_clamp(param, 0, RSGL_POSTFX_PARAM_MAX - 1)];
+}
+
+static int rsgl_postfx_pass_count(const RsglPostfxConfig *config)
+{
+    // Effect, each halving, two blur directions and the composite
+    return config ? config->downsamples + 4 : 1;
+}
+
+static int rsgl_postfx_kernel_index(int taps)
+{
+    for (int i = 0; i < RSGL_POSTFX_KERNELS; ++i) {
+        if (rsgl_postfx_kernel_taps[i] == taps) {
+            return i;
+        }
+    }
+    return 0;
+}
+
+static Uint32 rsgl_postfx_bind_samplers(Uint32 program, const char *first, const char *second)
+{
+    if (!program) {
+        return 0;
+    }
+    glUseProgram(program);
+    glUniform1i(glGetUniformLocation(program, first), 0);
+    if (second) {
+        glUniform1i(glGetUniformLocation(program, second), 1);
+    }
+    glUseProgram(0);
+    return program;
+}
+
+static SDL_bool rsgl_postfx_build_blur(int kernel)
+{
+    RsglPostfxBlur *blur = &g_postfx.blur[kernel];
+    if (blur->program) {
+        return SDL_TRUE;
+    }
+
+    const int radius = (rsgl_postfx_kernel_taps[kernel] - 1) / 2;
+    char source[1024];
+    SDL_snprintf(source, sizeof(source), "#define RSGL_RADIUS %d\n%s", radius, rsgl_postfx_blur_src);
+    blur->program = rsgl_postfx_bind_samplers(rsgl_gl_build(rsgl_postfx_vertex_src, source),
+                                              "u_source",
+                                              NULL);
+    if (!blur->program) {
+        return SDL_FALSE;
+    }
+    blur->step = glGetUniformLocation(blur->program, "u_step");
+    blur->weights = glGetUniformLocation(blur->program, "u_weights");
+
+    // Sigma of radius / 2 puts the outermost tap near 2 standard deviations
+    const double sigma = (double)radius * 0.5;
+    double total = 0.0;
+    for (int i = 0; i <= radius; ++i) {
+        const double weight = exp(-(double)(i * i) / (2.0 * sigma * sigma));
+        blur->weight_values[i] = (float)weight;
+        total += (i == 0) ? weight : weight * 2.0;
+    }
+    for (int i = 0; i <= radius; ++i) {
+        blur->weight_values[i] = (float)(blur->weight_values[i] / total);
+    }
+    return SDL_TRUE;
+}
+
+static SDL_bool rsgl_postfx_build_programs(void)
+{
+    if (!g_postfx.downsample_program) {
+        g_postfx.downsample_program =
+            rsgl_postfx_bind_samplers(rsgl_gl_build(rsgl_postfx_vertex_src, rsgl_postfx_downsample_src),
+                                      "u_source",
+                                      NULL);
+        if (!g_postfx.downsample_program) {
+            return SDL_FALSE;
+        }
+        g_postfx.downsample_texel = glGetUniformLocation(g_postfx.downsample_program, "u_texel");
+        g_postfx.downsample_threshold = glGetUniformLocation(g_postfx.downsample_program, "u_threshold");
+    }
+    if (!g_postfx.composite_program) {
+        g_postfx.composite_program =
+            rsgl_postfx_bind_samplers(rsgl_gl_build(rsgl_postfx_vertex_src, rsgl_postfx_composite_src),
+                                      "u_scene",
+                                      "u_bloom");
+        if (!g_postfx.composite_program) {
+            return SDL_FALSE;
+        }
+        g_postfx.composite_intensity = glGetUniformLocation(g_postfx.composite_program, "u_intensity");
+    }
+    return SDL_TRUE;
+}
+
+static GLenum rsgl_postfx_size_target(int index, int width, int height)
+{
+    g_postfx.width[index] = width;
+    g_postfx.height[index] = height;
+
+    glBindTexture(GL_TEXTURE_2D, g_postfx.texture[index]);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    // GLES2 only samples non-power-of-two textures with clamped wrapping
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, g_postfx.fbo[index]);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, g_postfx.texture[index], 0);
+    return glCheckFramebufferStatus(GL_FRAMEBUFFER);
+}
+
+// Allocates only the targets this configuration uses; the rest keep whatever they last held
+static SDL_bool rsgl_postfx_size_targets(const RsglState *state, int index, const RsglPostfxConfig *config)
+{
+    int width = state->fbo_width * config->scale;
+    int height = state->fbo_height * config->scale;
+    GLenum status = rsgl_postfx_size_target(RSGL_POSTFX_SCENE, width, height);
+    for (int i = 0; i < config->downsamples && status == GL_FRAMEBUFFER_COMPLETE; ++i) {
+        width = SDL_max(1, width / 2);
+        height = SDL_max(1, height / 2);
+        status = rsgl_postfx_size_target(RSGL_POSTFX_CHAIN + i, width, height);
+    }
+    if (status == GL_FRAMEBUFFER_COMPLETE) {
+        status = rsgl_postfx_size_target(RSGL_POSTFX_BLUR, width, height);
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    if (status != GL_FRAMEBUFFER_COMPLETE) {
+        SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+                    "rsgl_postfx_size_targets: framebuffer incomplete (0x%04x)",
+                    status);
+        return SDL_FALSE;
+    }
+    g_postfx.sized_config = index;
+    g_postfx.sized_fbo_width = state->fbo_width;
+    g_postfx.sized_fbo_height = state->fbo_height;
+    return SDL_TRUE;
+}
+
+// Creates objects on first use and resizes them when the configuration or FBO size changed
+static SDL_bool rsgl_postfx_prepare(const RsglState *state, int index, const RsglPostfxConfig *config)
+{
+    if (!g_postfx.created) {
+        glGenTextures(RSGL_POSTFX_TARGETS, g_postfx.texture);
+        glGenFramebuffers(RSGL_POSTFX_TARGETS, g_postfx.fbo);
+        g_postfx.created = SDL_TRUE;
+        g_postfx.sized_config = 0;
+    }
+    if (!rsgl_postfx_build_programs() || !rsgl_postfx_build_blur(rsgl_postfx_kernel_index(config->taps))) {
+        return SDL_FALSE;
+    }
+    if (g_postfx.sized_config == index &&
+        g_postfx.sized_fbo_width == state->fbo_width &&
+        g_postfx.sized_fbo_height == state->fbo_height) {
+        return SDL_TRUE;
+    }
+    return rsgl_postfx_size_targets(state, index, config);
+}
+
+void rsgl_postfx_account(RsglState *state, double frame_ms)
+{
+    if (!state) {
+        return;
+    }
+    const int index = state->postfx_drawn_config;
+    if (index < 0 || index > RSGL_POSTFX_CONFIGS) {
+        return;
+    }
+    state->postfx_ms[index] += frame_ms;
+    state->postfx_frames[index]++;
+    state->postfx_config_pixels[index] += state->postfx_pixels;
+    state->postfx_config_fetches[index] += state->postfx_fetches;
+}
+
+SDL_bool rsgl_postfx_begin(RsglState *state)
+{
+    if (!state) {
+        return SDL_FALSE;
+    }
+
+    // Plain single-pass frame unless the chain below takes over
+    state->postfx_drawn_config = 0;
+    state->postfx_passes = 1;
+    state->postfx_pixels = (Uint64)state->fbo_width * (Uint64)state->fbo_height;
+    state->postfx_fetches = 0;
+
+    const int index = rsgl_postfx_config_index(state);
+    RsglPostfxConfig config;
+    if (!rsgl_postfx_config(index, &config) || g_postfx.failed) {
+        return SDL_FALSE;
+    }
+    if (!rsgl_postfx_prepare(state, index, &config)) {
+        SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+                    "rsgl_postfx_begin: post-processing unavailable, drawing effects directly");
+        g_postfx.failed = SDL_TRUE;
+        state->postfx_enabled = SDL_FALSE;
+        return SDL_FALSE;
+    }
+
+    state->postfx_drawn_config = index;
+    glBindFramebuffer(GL_FRAMEBUFFER, g_postfx.fbo[RSGL_POSTFX_SCENE]);
+    glViewport(0, 0, g_postfx.width[RSGL_POSTFX_SCENE], g_postfx.height[RSGL_POSTFX_SCENE]);
+    return SDL_TRUE;
+}
+
+// Draws `source` into `target` with whatever program is bound; returns the fragments shaded
+static Uint64 rsgl_postfx_pass(const RsglState *state, int source, int target)
+{
+    glBindFramebuffer(GL_FRAMEBUFFER, g_postfx.fbo[target]);
+    glViewport(0, 0, g_postfx.width[target], g_postfx.height[target]);
+    glBindTexture(GL_TEXTURE_2D, g_postfx.texture[source]);
+    rsgl_gl_draw_quad(state->gl_vbo, state->gl_ibo, RSGL_QUAD_INDEX_COUNT);
+    return (Uint64)g_postfx.width[target] * (Uint64)g_postfx.height[target];
+}
+
+void rsgl_postfx_end(RsglState *state, Uint32 target_fbo, int width, int height)
+{
+    RsglPostfxConfig config;
+    if (!rsgl_postfx_config(state->postfx_drawn_config, &config)) {
+        return;
+    }
+
+    Uint64 pixels = (Uint64)g_postfx.width[RSGL_POSTFX_SCENE] * (Uint64)g_postfx.height[RSGL_POSTFX_SCENE];
+    glActiveTexture(GL_TEXTURE0);
+
+    glUseProgram(g_postfx.downsample_program);
+    int source = RSGL_POSTFX_SCENE;
+    for (int i = 0; i < config.downsamples; ++i) {
+        const int target = RSGL_POSTFX_CHAIN + i;
+        glUniform2f(g_postfx.downsample_texel,
+                    1.0f / (float)g_postfx.width[source],
+                    1.0f / (float)g_postfx.height[source]);
+        glUniform1f(g_postfx.downsample_threshold, (i == 0) ? RSGL_POSTFX_THRESHOLD : 0.0f);
+        pixels += rsgl_postfx_pass(state, source, target);
+        source = target;
+    }
+
+    // Horizontal into the scratch buffer, vertical back into the smallest level
+    const RsglPostfxBlur *blur = &g_postfx.blur[rsgl_postfx_kernel_index(config.taps)];
+    glUseProgram(blur->program);
+    glUniform1fv(blur->weights, (config.taps + 1) / 2, blur->weight_values);
+    glUniform2f(blur->step, 1.0f / (float)g_postfx.width[source], 0.0f);
+    Uint64 blurred = rsgl_postfx_pass(state, source, RSGL_POSTFX_BLUR);
+    glUniform2f(blur->step, 0.0f, 1.0f / (float)g_postfx.height[source]);
+    blurred += rsgl_postfx_pass(state, RSGL_POSTFX_BLUR, source);
+    pixels += blurred;
+
+    glBindFramebuffer(GL_FRAMEBUFFER, target_fbo);
+    glViewport(0, 0, width, height);
+    glUseProgram(g_postfx.composite_program);
+    glUniform1f(g_postfx.composite_intensity, RSGL_POSTFX_INTENSITY);
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_2D, g_postfx.texture[source]);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, g_postfx.texture[RSGL_POSTFX_SCENE]);
+    rsgl_gl_draw_quad(state->gl_vbo, state->gl_ibo, RSGL_QUAD_INDEX_COUNT);
+    pixels += (Uint64)width * (Uint64)height;
+
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glUseProgram(0);
+
+    state->postfx_passes = rsgl_postfx_pass_count(&config);
+    state->postfx_pixels = pixels;
+    state->postfx_fetches = blurred * (Uint64)config.taps;
+}
+
+/*
+ * Least-squares split of the measured frame times into a base cost, a cost
+ * per pass (FBO switch plus draw setup), per million fragments shaded and
+ * per million blur fetches. Needs configurations that vary each parameter
+ * on its own; SDL_FALSE while the samples cannot tell the terms apart.
+ */
+static SDL_bool rsgl_postfx_fit(const RsglState *state, double cost[RSGL_POSTFX_FIT_TERMS], int *samples)
+{
+    double normal[RSGL_POSTFX_FIT_TERMS][RSGL_POSTFX_FIT_TERMS];
+    double rhs[RSGL_POSTFX_FIT_TERMS];
+    SDL_memset(normal, 0, sizeof(normal));
+    SDL_memset(rhs, 0, sizeof(rhs));
+    *samples = 0;
+    for (int i = 0; i <= RSGL_POSTFX_CONFIGS; ++i) {
+        const Uint64 frames = state->postfx_frames[i];
+        if (frames == 0) {
+            continue;
+        }
+        RsglPostfxConfig config;
+        const SDL_bool on = rsgl_postfx_config(i, &config);
+        const double features[RSGL_POSTFX_FIT_TERMS] = {
+            1.0,
+            (double)rsgl_postfx_pass_count(on ? &config : NULL),
+            (double)state->postfx_config_pixels[i] / (double)frames / 1000000.0,
+            (double)state->postfx_config_fetches[i] / (double)frames / 1000000.0
+        };
+        const double frame_ms = state->postfx_ms[i] / (double)frames;
+        for (int r = 0; r < RSGL_POSTFX_FIT_TERMS; ++r) {
+            for (int c = 0; c < RSGL_POSTFX_FIT_TERMS; ++c) {
+                normal[r][c] += features[r] * features[c];
+            }
+            rhs[r] += features[r] * frame_ms;
+        }
+        (*samples)++;
+    }
+    if (*samples < RSGL_POSTFX_FIT_TERMS) {
+        return SDL_FALSE;
+    }
+    return rsgl_solve_linear(&normal[0][0], rhs, cost, RSGL_POSTFX_FIT_TERMS);
+}
+
+void rsgl_postfx_report(const RsglState *state)
+{
+    if (!state) {
+        return;
+    }
+
+    const double off_ms = state->postfx_frames[0] ?
+        state->postfx_ms[0] / (double)state->postfx_frames[0] : 0.0;
+    for (int i = 0; i <= RSGL_POSTFX_CONFIGS; ++i) {
+        if (state->postfx_frames[i] == 0) {
+            continue;
+        }
+        const double frame_ms = state->postfx_ms[i] / (double)state->postfx_frames[i];
+        const double mpx_s = state->postfx_ms[i] > 0.0 ?
+            (double)state->postfx_config_pixels[i] / (state->postfx_ms[i] * 1000.0) : 0.0;
+        RsglPostfxConfig config;
+        if (!rsgl_postfx_config(i, &config)) {
+            SDL_Log("PostFX off: %.2fms/frame | %.1f Mpx/s (%llu)",
+                    frame_ms,
+                    mpx_s,
+                    (unsigned long long)state->postfx_frames[i]);
+            continue;
+        }
+        SDL_Log("PostFX %d down, %2d taps, %dx: %.2fms/frame (%+.2f vs off) | %d passes | %.1f Mpx/s (%llu)",
+                config.downsamples,
+                config.taps,
+                config.scale,
+                frame_ms,
+                off_ms > 0.0 ? frame_ms - off_ms : 0.0,
+                rsgl_postfx_pass_count(&config),
+                mpx_s,
+                (unsigned long long)state->postfx_frames[i]);
+    }
+
+    double cost[RSGL_POSTFX_FIT_TERMS];
+    int samples = 0;
+    if (rsgl_postfx_fit(state, cost, &samples)) {
+        SDL_Log("PostFX fit over %d configs: base %.2fms | %.3fms/pass | %.3fms/Mpx | %.3fms/M fetches",
+                samples,
+                cost[0],
+                cost[1],
+                cost[2],
+                cost[3]);
+    } else if (samples > 0) {
+        SDL_Log("PostFX fit: %d configs measured, vary passes, scale and taps separately to split the cost",
+                samples);
+    }
+}
+
+void rsgl_postfx_cleanup(RsglState *state)
+{
+    (void)state;
+
+    if (g_postfx.created) {
+        glDeleteFramebuffers(RSGL_POSTFX_TARGETS, g_postfx.fbo);
+        glDeleteTextures(RSGL_POSTFX_TARGETS, g_postfx.texture);
+    }
+    if (g_postfx.downsample_program) {
+        glDeleteProgram(g_postfx.downsample_program);
+    }
+    if (g_postfx.composite_program) {
+        glDeleteProgram(g_postfx.composite_program);
+    }
+    for (int i = 0; i < RSGL_POSTFX_KERNELS; ++i) {
+        if (g_postfx.blur[i].program) {
+            glDeleteProgram(g_postfx.blur[i].program);
+        }
+    }
+    SDL_memset(&g_postfx, 0, sizeof(g_postfx));
+}
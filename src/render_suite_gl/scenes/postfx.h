@@ -0,0 +1,38 @@
+#ifndef RENDER_SUITE_GL_SCENES_POSTFX_H
+#define RENDER_SUITE_GL_SCENES_POSTFX_H
+
+#include <SDL2/SDL.h>
+
+#include "render_suite_gl/state.h"
+
+/*
+ * Bloom chain run on top of the current effect: the effect is drawn into a
+ * scene target at `scale` x the FBO size, bright parts are halved
+ * `downsamples` times, blurred with a separable `taps`-wide Gaussian at the
+ * smallest size and added back while resolving into the ring FBO. The three
+ * are set independently (RsglPostfxParam) so pass count, fill rate and
+ * fetch cost can each be varied on their own.
+ */
+typedef struct {
+    int downsamples;
+    int taps;
+    int scale;
+} RsglPostfxConfig;
+
+// 0 when post-processing is off, else 1..RSGL_POSTFX_CONFIGS for the selected parameters
+int rsgl_postfx_config_index(const RsglState *state);
+SDL_bool rsgl_postfx_config(int index, RsglPostfxConfig *config); // SDL_FALSE for 0 or out of range
+const char *rsgl_postfx_param_name(int param);
+
+// Call once per frame before drawing with the last frame's time
+void rsgl_postfx_account(RsglState *state, double frame_ms);
+
+// With GL current: binds the scene target and its viewport. SDL_FALSE when
+// post-processing is off or unavailable, in which case draw straight to the ring.
+SDL_bool rsgl_postfx_begin(RsglState *state);
+void rsgl_postfx_end(RsglState *state, Uint32 target_fbo, int width, int height);
+
+void rsgl_postfx_report(const RsglState *state);
+void rsgl_postfx_cleanup(RsglState *state); // GL must be current
+
+#endif /* RENDER_SUITE_GL_SCENES_POSTFX_H */
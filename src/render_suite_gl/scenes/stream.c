@@ -0,0 +1,327 @@
+#include "render_suite_gl/scenes/stream.h"
+
+#include <SDL2/SDL_log.h>
+#include <SDL2/SDL_opengles2.h>
+
+#include <math.h>
+#include <stdint.h>
+
+#include "render_suite_gl/gl_util.h"
+
+#define RSGL_STREAM_SPRITES 4096
+#define RSGL_STREAM_VERTICES (RSGL_STREAM_SPRITES * 4) // Stays within GL_UNSIGNED_SHORT indices
+#define RSGL_STREAM_INDICES (RSGL_STREAM_SPRITES * 6)
+#define RSGL_STREAM_BUFFERS 3                          // Ring segments and round-robin VBOs
+#define RSGL_STREAM_SPRITE_SIZE 0.035f                 // Half extent in clip space
+
+typedef struct {
+    GLfloat x;
+    GLfloat y;
+    GLfloat u;
+    GLfloat v;
+    Uint8 r;
+    Uint8 g;
+    Uint8 b;
+    Uint8 a;
+} RsglStreamVertex;
+
+typedef struct {
+    float x;
+    float y;
+    float vx;   // Screens per second, wrapping at the edges
+    float vy;
+    Uint8 r;
+    Uint8 g;
+    Uint8 b;
+} RsglStreamSprite;
+
+static const char *rsgl_stream_names[RSGL_STREAM_MODE_MAX] = {
+    "Off",
+    "Orphan",
+    "SubData Ring",
+    "Round Robin",
+    "Client Array"
+};
+
+static const char *rsgl_stream_vertex_src =
+    "attribute vec2 a_position;\n"
+    "attribute vec2 a_uv;\n"
+    "attribute vec4 a_color;\n"
+    "varying vec2 v_uv;\n"
+    "varying vec4 v_color;\n"
+    "void main() {\n"
+    "    gl_Position = vec4(a_position, 0.0, 1.0);\n"
+    "    v_uv = a_uv * 2.0 - 1.0;\n"
+    "    v_color = a_color;\n"
+    "}\n";
+
+static const char *rsgl_stream_fragment_src =
+    "precision mediump float;\n"
+    "varying vec2 v_uv;\n"
+    "varying vec4 v_color;\n"
+    "void main() {\n"
+    "    float fade = 1.0 - smoothstep(0.5, 1.0, length(v_uv));\n"
+    "    gl_FragColor = vec4(v_color.rgb, v_color.a * fade);\n"
+    "}\n";
+
+typedef struct {
+    SDL_bool created;
+    SDL_bool failed;
+    Uint32 program;
+    int color_loc;
+    Uint32 ibo;
+    Uint32 orphan_vbo;
+    Uint32 ring_vbo;                          // RSGL_STREAM_BUFFERS frames long
+    Uint32 round_robin_vbo[RSGL_STREAM_BUFFERS];
+    int ring_segment;
+    int round_robin_index;
+    RsglStreamSprite *sprites;
+    RsglStreamVertex *vertices;
+} RsglStream;
+
+static RsglStream g_stream;
+
+int rsgl_stream_vertex_count(void)
+{
+    return RSGL_STREAM_VERTICES;
+}
+
+const char *rsgl_stream_name(int mode)
+{
+    return rsgl_stream_names[SDL_clamp(mode, 0, RSGL_STREAM_MODE_MAX - 1)];
+}
+
+static SDL_bool rsgl_stream_create(void)
+{
+    g_stream.created = SDL_TRUE;
+
+    g_stream.sprites = (RsglStreamSprite *)SDL_malloc(sizeof(RsglStreamSprite) * RSGL_STREAM_SPRITES);
+    g_stream.vertices = (RsglStreamVertex *)SDL_malloc(sizeof(RsglStreamVertex) * RSGL_STREAM_VERTICES);
+    GLushort *indices = (GLushort *)SDL_malloc(sizeof(GLushort) * RSGL_STREAM_INDICES);
+    g_stream.program = rsgl_gl_build(rsgl_stream_vertex_src, rsgl_stream_fragment_src);
+    if (!g_stream.sprites || !g_stream.vertices || !indices || !g_stream.program) {
+        SDL_free(indices);
+        return SDL_FALSE;
+    }
+    g_stream.color_loc = glGetAttribLocation(g_stream.program, "a_color");
+
+    Uint32 seed = 0x9E3779B9u;
+    for (int i = 0; i < RSGL_STREAM_SPRITES; ++i) {
+        RsglStreamSprite *sprite = &g_stream.sprites[i];
+        float random[5];
+        for (int k = 0; k < 5; ++k) {
+            seed = seed * 1664525u + 1013904223u;
+            random[k] = (float)(seed >> 8) / 16777216.0f;
+        }
+        sprite->x = random[0];
+        sprite->y = random[1];
+        sprite->vx = (random[2] - 0.5f) * 0.4f;
+        sprite->vy = (random[3] - 0.5f) * 0.4f;
+        sprite->r = (Uint8)(120 + (int)(random[4] * 135.0f));
+        sprite->g = (Uint8)(80 + (i * 37) % 176);
+        sprite->b = (Uint8)(255 - (int)(random[4] * 120.0f));
+    }
+
+    for (int i = 0; i < RSGL_STREAM_SPRITES; ++i) {
+        const GLushort base = (GLushort)(i * 4);
+        GLushort *quad = &indices[i * 6];
+        quad[0] = base;
+        quad[1] = (GLushort)(base + 1);
+        quad[2] = (GLushort)(base + 2);
+        quad[3] = base;
+        quad[4] = (GLushort)(base + 2);
+        quad[5] = (GLushort)(base + 3);
+    }
+    glGenBuffers(1, &g_stream.ibo);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, g_stream.ibo);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(GLushort) * RSGL_STREAM_INDICES, indices, GL_STATIC_DRAW);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    SDL_free(indices);
+
+    const GLsizeiptr frame_bytes = (GLsizeiptr)(sizeof(RsglStreamVertex) * RSGL_STREAM_VERTICES);
+    glGenBuffers(1, &g_stream.orphan_vbo);
+    glBindBuffer(GL_ARRAY_BUFFER, g_stream.orphan_vbo);
+    glBufferData(GL_ARRAY_BUFFER, frame_bytes, NULL, GL_STREAM_DRAW);
+    glGenBuffers(1, &g_stream.ring_vbo);
+    glBindBuffer(GL_ARRAY_BUFFER, g_stream.ring_vbo);
+    glBufferData(GL_ARRAY_BUFFER, frame_bytes * RSGL_STREAM_BUFFERS, NULL, GL_DYNAMIC_DRAW);
+    glGenBuffers(RSGL_STREAM_BUFFERS, g_stream.round_robin_vbo);
+    for (int i = 0; i < RSGL_STREAM_BUFFERS; ++i) {
+        glBindBuffer(GL_ARRAY_BUFFER, g_stream.round_robin_vbo[i]);
+        glBufferData(GL_ARRAY_BUFFER, frame_bytes, NULL, GL_DYNAMIC_DRAW);
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    return SDL_TRUE;
+}
+
+// Positions are a function of time alone, so every mode streams identical data
+static void rsgl_stream_build(float time)
+{
+    const float size = RSGL_STREAM_SPRITE_SIZE;
+    for (int i = 0; i < RSGL_STREAM_SPRITES; ++i) {
+        const RsglStreamSprite *sprite = &g_stream.sprites[i];
+        const float px = sprite->x + sprite->vx * time;
+        const float py = sprite->y + sprite->vy * time;
+        const float cx = (px - floorf(px)) * 2.0f - 1.0f;
+        const float cy = (py - floorf(py)) * 2.0f - 1.0f;
+
+        RsglStreamVertex *quad = &g_stream.vertices[i * 4];
+        const RsglStreamVertex corners[4] = {
+            {cx - size, cy - size, 0.0f, 0.0f, sprite->r, sprite->g, sprite->b, 200},
+            {cx + size, cy - size, 1.0f, 0.0f, sprite->r, sprite->g, sprite->b, 200},
+            {cx + size, cy + size, 1.0f, 1.0f, sprite->r, sprite->g, sprite->b, 200},
+            {cx - size, cy + size, 0.0f, 1.0f, sprite->r, sprite->g, sprite->b, 200},
+        };
+        SDL_memcpy(quad, corners, sizeof(corners));
+    }
+}
+
+void rsgl_stream_account(RsglState *state, double frame_ms)
+{
+    if (!state) {
+        return;
+    }
+    const int mode = state->stream_drawn_mode;
+    if (mode < 0 || mode >= RSGL_STREAM_MODE_MAX) {
+        return;
+    }
+    state->stream_frame_ms[mode] += frame_ms;
+    state->stream_frames[mode]++;
+    state->stream_total_vertices[mode] += (Uint64)state->stream_vertices;
+}
+
+void rsgl_stream_draw(RsglState *state)
+{
+    if (!state) {
+        return;
+    }
+
+    const int mode = SDL_clamp(state->stream_mode, 0, RSGL_STREAM_MODE_MAX - 1);
+    state->stream_drawn_mode = RSGL_STREAM_OFF;
+    state->stream_vertices = 0;
+    if (mode == RSGL_STREAM_OFF || g_stream.failed) {
+        return;
+    }
+    if (!g_stream.created && !rsgl_stream_create()) {
+        SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "rsgl_stream_draw: sprite streaming unavailable");
+        g_stream.failed = SDL_TRUE;
+        state->stream_mode = RSGL_STREAM_OFF;
+        return;
+    }
+
+    rsgl_stream_build(state->elapsed_time);
+
+    const Uint64 start = SDL_GetPerformanceCounter();
+    const GLsizeiptr frame_bytes = (GLsizeiptr)(sizeof(RsglStreamVertex) * RSGL_STREAM_VERTICES);
+    uintptr_t base = 0; // Offset into the bound VBO, or the client array address
+    switch (mode) {
+        case RSGL_STREAM_ORPHAN:
+            // Dropping the old storage lets the driver hand back fresh memory instead of waiting
+            glBindBuffer(GL_ARRAY_BUFFER, g_stream.orphan_vbo);
+            glBufferData(GL_ARRAY_BUFFER, frame_bytes, NULL, GL_STREAM_DRAW);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, frame_bytes, g_stream.vertices);
+            break;
+        case RSGL_STREAM_SUBDATA_RING: {
+            const GLintptr offset = (GLintptr)frame_bytes * g_stream.ring_segment;
+            glBindBuffer(GL_ARRAY_BUFFER, g_stream.ring_vbo);
+            glBufferSubData(GL_ARRAY_BUFFER, offset, frame_bytes, g_stream.vertices);
+            base = (uintptr_t)offset;
+            g_stream.ring_segment = (g_stream.ring_segment + 1) % RSGL_STREAM_BUFFERS;
+            break;
+        }
+        case RSGL_STREAM_ROUND_ROBIN:
+            glBindBuffer(GL_ARRAY_BUFFER, g_stream.round_robin_vbo[g_stream.round_robin_index]);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, frame_bytes, g_stream.vertices);
+            g_stream.round_robin_index = (g_stream.round_robin_index + 1) % RSGL_STREAM_BUFFERS;
+            break;
+        default:
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+            base = (uintptr_t)g_stream.vertices;
+            break;
+    }
+
+    const GLsizei stride = (GLsizei)sizeof(RsglStreamVertex);
+    glEnableVertexAttribArray(RSGL_POSITION_LOC);
+    glVertexAttribPointer(RSGL_POSITION_LOC, 2, GL_FLOAT, GL_FALSE, stride, (const void *)base);
+    glEnableVertexAttribArray(RSGL_TEXCOORD_LOC);
+    glVertexAttribPointer(RSGL_TEXCOORD_LOC, 2, GL_FLOAT, GL_FALSE, stride,
+                          (const void *)(base + sizeof(GLfloat) * 2));
+    if (g_stream.color_loc >= 0) {
+        glEnableVertexAttribArray((GLuint)g_stream.color_loc);
+        glVertexAttribPointer((GLuint)g_stream.color_loc, 4, GL_UNSIGNED_BYTE, GL_TRUE, stride,
+                              (const void *)(base + sizeof(GLfloat) * 4));
+    }
+
+    glUseProgram(g_stream.program);
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, g_stream.ibo);
+    glDrawElements(GL_TRIANGLES, RSGL_STREAM_INDICES, GL_UNSIGNED_SHORT, (const void *)0);
+
+    if (g_stream.color_loc >= 0) {
+        glDisableVertexAttribArray((GLuint)g_stream.color_loc);
+    }
+    glDisableVertexAttribArray(RSGL_TEXCOORD_LOC);
+    glDisableVertexAttribArray(RSGL_POSITION_LOC);
+    glDisable(GL_BLEND);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glUseProgram(0);
+
+    const double elapsed_ms = rsgl_gl_elapsed_ms(start, SDL_GetPerformanceCounter());
+    state->stream_submit_last_ms = elapsed_ms;
+    state->stream_submit_ms[mode] += elapsed_ms;
+    state->stream_drawn_mode = mode;
+    state->stream_vertices = RSGL_STREAM_VERTICES;
+}
+
+void rsgl_stream_report(const RsglState *state)
+{
+    if (!state) {
+        return;
+    }
+
+    const double off_ms = state->stream_frames[RSGL_STREAM_OFF] ?
+        state->stream_frame_ms[RSGL_STREAM_OFF] / (double)state->stream_frames[RSGL_STREAM_OFF] : 0.0;
+    for (int mode = RSGL_STREAM_OFF + 1; mode < RSGL_STREAM_MODE_MAX; ++mode) {
+        const Uint64 frames = state->stream_frames[mode];
+        if (frames == 0) {
+            continue;
+        }
+        const double vertices = (double)state->stream_total_vertices[mode];
+        const double frame_ms = state->stream_frame_ms[mode] / (double)frames;
+        SDL_Log("Stream %-12s: submit %.3fms | %.2f Mverts/s submit | %.2f Mverts/s frame | "
+                "frame %.2fms (%+.2f vs off) (%llu)",
+                rsgl_stream_names[mode],
+                state->stream_submit_ms[mode] / (double)frames,
+                state->stream_submit_ms[mode] > 0.0 ? vertices / (state->stream_submit_ms[mode] * 1000.0) : 0.0,
+                state->stream_frame_ms[mode] > 0.0 ? vertices / (state->stream_frame_ms[mode] * 1000.0) : 0.0,
+                frame_ms,
+                off_ms > 0.0 ? frame_ms - off_ms : 0.0,
+                (unsigned long long)frames);
+    }
+}
+
+void rsgl_stream_cleanup(RsglState *state)
+{
+    (void)state;
+
+    if (g_stream.program) {
+        glDeleteProgram(g_stream.program);
+    }
+    if (g_stream.ibo) {
+        glDeleteBuffers(1, &g_stream.ibo);
+    }
+    if (g_stream.orphan_vbo) {
+        glDeleteBuffers(1, &g_stream.orphan_vbo);
+    }
+    if (g_stream.ring_vbo) {
+        glDeleteBuffers(1, &g_stream.ring_vbo);
+    }
+    if (g_stream.round_robin_vbo[0]) {
+        glDeleteBuffers(RSGL_STREAM_BUFFERS, g_stream.round_robin_vbo);
+    }
+    SDL_free(g_stream.sprites);
+    SDL_free(g_stream.vertices);
+    SDL_memset(&g_stream, 0, sizeof(g_stream));
+}
@@ -0,0 +1,25 @@
+#ifndef RENDER_SUITE_GL_SCENES_STREAM_H
+#define RENDER_SUITE_GL_SCENES_STREAM_H
+
+#include <SDL2/SDL.h>
+
+#include "render_suite_gl/state.h"
+
+/*
+ * Sprite layer drawn over the effect with vertices rebuilt every frame, as
+ * SDL's GLES renderer does for its own batches. Each RsglStreamMode gets
+ * the same vertices to the GPU a different way.
+ */
+int rsgl_stream_vertex_count(void);
+const char *rsgl_stream_name(int mode);
+
+// Call once per frame before drawing with the last frame's time
+void rsgl_stream_account(RsglState *state, double frame_ms);
+
+// With GL current and the frame's target bound: streams and draws the sprites
+void rsgl_stream_draw(RsglState *state);
+
+void rsgl_stream_report(const RsglState *state);
+void rsgl_stream_cleanup(RsglState *state); // GL must be current
+
+#endif /* RENDER_SUITE_GL_SCENES_STREAM_H */
@@ -0,0 +1,368 @@
+#include "render_suite_gl/scenes/tex_formats.h"
+
+#include <SDL2/SDL_log.h>
+#include <SDL2/SDL_opengles2.h>
+
+#include "render_suite_gl/gl_util.h"
+
+#define RSGL_TEXFMT_WIDTH BENCH_SCREEN_W
+#define RSGL_TEXFMT_HEIGHT BENCH_SCREEN_H
+#define RSGL_TEXFMT_UPLOADS 4          // Timed uploads per cell, after one untimed warm-up
+#define RSGL_TEXFMT_CSV_NAME "rsgl_tex_formats.csv"
+
+typedef void (*RsglTexfmtConvert)(const Uint8 *src, Uint8 *dst, int width);
+
+typedef struct {
+    const char *name;
+    GLenum format;
+    GLenum type;
+    int bytes_per_pixel;
+    RsglTexfmtConvert convert;
+} RsglTexfmt;
+
+static void rsgl_texfmt_rgba8888(const Uint8 *src, Uint8 *dst, int width)
+{
+    SDL_memcpy(dst, src, (size_t)width * 4u);
+}
+
+static void rsgl_texfmt_rgb888(const Uint8 *src, Uint8 *dst, int width)
+{
+    for (int x = 0; x < width; ++x, src += 4, dst += 3) {
+        dst[0] = src[0];
+        dst[1] = src[1];
+        dst[2] = src[2];
+    }
+}
+
+static void rsgl_texfmt_rgb565(const Uint8 *src, Uint8 *dst, int width)
+{
+    Uint16 *out = (Uint16 *)dst;
+    for (int x = 0; x < width; ++x, src += 4) {
+        out[x] = (Uint16)(((src[0] >> 3) << 11) | ((src[1] >> 2) << 5) | (src[2] >> 3));
+    }
+}
+
+static void rsgl_texfmt_rgba4444(const Uint8 *src, Uint8 *dst, int width)
+{
+    Uint16 *out = (Uint16 *)dst;
+    for (int x = 0; x < width; ++x, src += 4) {
+        out[x] = (Uint16)(((src[0] >> 4) << 12) | ((src[1] >> 4) << 8) | ((src[2] >> 4) << 4) | (src[3] >> 4));
+    }
+}
+
+static void rsgl_texfmt_rgba5551(const Uint8 *src, Uint8 *dst, int width)
+{
+    Uint16 *out = (Uint16 *)dst;
+    for (int x = 0; x < width; ++x, src += 4) {
+        out[x] = (Uint16)(((src[0] >> 3) << 11) | ((src[1] >> 3) << 6) | ((src[2] >> 3) << 1) | (src[3] >> 7));
+    }
+}
+
+static void rsgl_texfmt_luminance(const Uint8 *src, Uint8 *dst, int width)
+{
+    for (int x = 0; x < width; ++x, src += 4) {
+        dst[x] = (Uint8)((src[0] * 77 + src[1] * 150 + src[2] * 29) >> 8);
+    }
+}
+
+static const RsglTexfmt rsgl_texfmts[RSGL_TEXFMT_FORMATS] = {
+    {"RGBA8888", GL_RGBA, GL_UNSIGNED_BYTE, 4, rsgl_texfmt_rgba8888},
+    {"RGB888", GL_RGB, GL_UNSIGNED_BYTE, 3, rsgl_texfmt_rgb888},
+    {"RGB565", GL_RGB, GL_UNSIGNED_SHORT_5_6_5, 2, rsgl_texfmt_rgb565},
+    {"RGBA4444", GL_RGBA, GL_UNSIGNED_SHORT_4_4_4_4, 2, rsgl_texfmt_rgba4444},
+    {"RGBA5551", GL_RGBA, GL_UNSIGNED_SHORT_5_5_5_1, 2, rsgl_texfmt_rgba5551},
+    {"LUMINANCE", GL_LUMINANCE, GL_UNSIGNED_BYTE, 1, rsgl_texfmt_luminance}
+};
+
+static const SDL_Rect rsgl_texfmt_regions[RSGL_TEXFMT_REGIONS] = {
+    {0, 0, RSGL_TEXFMT_WIDTH, RSGL_TEXFMT_HEIGHT},
+    {RSGL_TEXFMT_WIDTH / 4, RSGL_TEXFMT_HEIGHT / 4, RSGL_TEXFMT_WIDTH / 2, RSGL_TEXFMT_HEIGHT / 2}
+};
+
+static const char *rsgl_texfmt_vertex_src =
+    "attribute vec2 a_position;\n"
+    "attribute vec2 a_uv;\n"
+    "varying vec2 v_uv;\n"
+    "void main() {\n"
+    "    gl_Position = vec4(a_position, 0.0, 1.0);\n"
+    "    v_uv = a_uv;\n"
+    "}\n";
+
+static const char *rsgl_texfmt_fragment_src =
+    "precision mediump float;\n"
+    "varying vec2 v_uv;\n"
+    "uniform sampler2D u_texture;\n"
+    "void main() {\n"
+    "    gl_FragColor = texture2D(u_texture, v_uv);\n"
+    "}\n";
+
+/*
+ * The upload only counts as done once a draw has sampled the texture:
+ * drivers are free to defer the copy or the GPU-side detiling until then.
+ * The sampling draw goes to a 1x1 target so it adds next to nothing.
+ */
+typedef struct {
+    SDL_bool created;
+    SDL_bool failed;    // Something could not be built; no sweep runs until cleanup
+    Uint32 texture;
+    Uint32 sample_fbo;
+    Uint32 sample_texture;
+    Uint32 program;
+    Uint8 *source;      // RGBA8888 frame, R G B A in memory
+    Uint8 *converted;   // Tightly packed region in the format under test
+} RsglTexfmtBench;
+
+static RsglTexfmtBench g_texfmt;
+
+int rsgl_tex_formats_cells(void)
+{
+    return RSGL_TEXFMT_FORMATS * RSGL_TEXFMT_REGIONS;
+}
+
+const char *rsgl_tex_formats_name(int format)
+{
+    return rsgl_texfmts[SDL_clamp(format, 0, RSGL_TEXFMT_FORMATS - 1)].name;
+}
+
+double rsgl_tex_formats_bytes(int format, int region)
+{
+    const SDL_Rect *rect = &rsgl_texfmt_regions[SDL_clamp(region, 0, RSGL_TEXFMT_REGIONS - 1)];
+    return (double)rect->w * (double)rect->h *
+           (double)rsgl_texfmts[SDL_clamp(format, 0, RSGL_TEXFMT_FORMATS - 1)].bytes_per_pixel;
+}
+
+int rsgl_tex_formats_fastest(const RsglState *state, int region)
+{
+    if (!state || !state->texfmt_measured || region < 0 || region >= RSGL_TEXFMT_REGIONS) {
+        return -1;
+    }
+    int best = 0;
+    for (int format = 1; format < RSGL_TEXFMT_FORMATS; ++format) {
+        if (state->texfmt_convert_ms[format][region] + state->texfmt_latency_ms[format][region] <
+            state->texfmt_convert_ms[best][region] + state->texfmt_latency_ms[best][region]) {
+            best = format;
+        }
+    }
+    return best;
+}
+
+static SDL_bool rsgl_texfmt_create(void)
+{
+    g_texfmt.created = SDL_TRUE;
+
+    const size_t frame_bytes = (size_t)RSGL_TEXFMT_WIDTH * RSGL_TEXFMT_HEIGHT * 4u;
+    g_texfmt.source = (Uint8 *)SDL_malloc(frame_bytes);
+    g_texfmt.converted = (Uint8 *)SDL_malloc(frame_bytes);
+    g_texfmt.program = rsgl_gl_build(rsgl_texfmt_vertex_src, rsgl_texfmt_fragment_src);
+    if (!g_texfmt.source || !g_texfmt.converted || !g_texfmt.program) {
+        return SDL_FALSE;
+    }
+
+    for (int y = 0; y < RSGL_TEXFMT_HEIGHT; ++y) {
+        Uint8 *row = g_texfmt.source + (size_t)y * RSGL_TEXFMT_WIDTH * 4u;
+        for (int x = 0; x < RSGL_TEXFMT_WIDTH; ++x) {
+            row[x * 4 + 0] = (Uint8)(x * 255 / RSGL_TEXFMT_WIDTH);
+            row[x * 4 + 1] = (Uint8)(y * 255 / RSGL_TEXFMT_HEIGHT);
+            row[x * 4 + 2] = (Uint8)((x ^ y) & 0xFF);
+            row[x * 4 + 3] = 255;
+        }
+    }
+
+    glUseProgram(g_texfmt.program);
+    glUniform1i(glGetUniformLocation(g_texfmt.program, "u_texture"), 0);
+    glUseProgram(0);
+
+    glGenTextures(1, &g_texfmt.texture);
+    glBindTexture(GL_TEXTURE_2D, g_texfmt.texture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+    glGenTextures(1, &g_texfmt.sample_texture);
+    glBindTexture(GL_TEXTURE_2D, g_texfmt.sample_texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    glGenFramebuffers(1, &g_texfmt.sample_fbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, g_texfmt.sample_fbo);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, g_texfmt.sample_texture, 0);
+    const GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    if (status != GL_FRAMEBUFFER_COMPLETE) {
+        SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+                    "rsgl_texfmt_create: framebuffer incomplete (0x%04x)",
+                    status);
+        return SDL_FALSE;
+    }
+    return SDL_TRUE;
+}
+
+// Packs the region into `converted` in the cell's format and returns the time taken
+static double rsgl_texfmt_convert(const RsglTexfmt *format, const SDL_Rect *rect)
+{
+    const Uint64 start = SDL_GetPerformanceCounter();
+    const size_t dst_pitch = (size_t)rect->w * (size_t)format->bytes_per_pixel;
+    for (int y = 0; y < rect->h; ++y) {
+        const Uint8 *src = g_texfmt.source +
+                           ((size_t)(rect->y + y) * RSGL_TEXFMT_WIDTH + (size_t)rect->x) * 4u;
+        format->convert(src, g_texfmt.converted + (size_t)y * dst_pitch, rect->w);
+    }
+    return rsgl_gl_elapsed_ms(start, SDL_GetPerformanceCounter());
+}
+
+static void rsgl_texfmt_upload(const RsglTexfmt *format, const SDL_Rect *rect)
+{
+    glBindTexture(GL_TEXTURE_2D, g_texfmt.texture);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, rect->x, rect->y, rect->w, rect->h,
+                    format->format, format->type, g_texfmt.converted);
+}
+
+static void rsgl_texfmt_sample(const RsglState *state)
+{
+    glBindFramebuffer(GL_FRAMEBUFFER, g_texfmt.sample_fbo);
+    glViewport(0, 0, 1, 1);
+    glUseProgram(g_texfmt.program);
+    rsgl_gl_draw_quad(state->gl_vbo, state->gl_ibo, RSGL_QUAD_INDEX_COUNT);
+    glUseProgram(0);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+static void rsgl_texfmt_report(const RsglState *state)
+{
+    char *base_path = SDL_GetBasePath();
+    char path[512];
+    SDL_snprintf(path, sizeof(path), "%s%s", base_path ? base_path : "", RSGL_TEXFMT_CSV_NAME);
+    SDL_free(base_path);
+
+    SDL_RWops *csv = SDL_RWFromFile(path, "w");
+    static const char header[] = "format,region,bytes,convert_ms,call_ms,latency_ms,upload_mb_s\n";
+    if (csv) {
+        SDL_RWwrite(csv, header, 1, sizeof(header) - 1);
+    }
+
+    for (int format = 0; format < RSGL_TEXFMT_FORMATS; ++format) {
+        for (int region = 0; region < RSGL_TEXFMT_REGIONS; ++region) {
+            const double bytes = rsgl_tex_formats_bytes(format, region);
+            const double latency_ms = state->texfmt_latency_ms[format][region];
+            const double mb_s = latency_ms > 0.0 ? bytes / (latency_ms * 1000.0) : 0.0;
+            SDL_Log("TexUpload %-9s %-4s: convert %.3fms | call %.3fms | done %.3fms | %.1f MB/s",
+                    rsgl_texfmts[format].name,
+                    region ? "sub" : "full",
+                    state->texfmt_convert_ms[format][region],
+                    state->texfmt_call_ms[format][region],
+                    latency_ms,
+                    mb_s);
+            if (csv) {
+                char line[160];
+                SDL_snprintf(line, sizeof(line), "%s,%s,%.0f,%.4f,%.4f,%.4f,%.1f\n",
+                             rsgl_texfmts[format].name,
+                             region ? "sub" : "full",
+                             bytes,
+                             state->texfmt_convert_ms[format][region],
+                             state->texfmt_call_ms[format][region],
+                             latency_ms,
+                             mb_s);
+                SDL_RWwrite(csv, line, 1, SDL_strlen(line));
+            }
+        }
+    }
+
+    if (csv) {
+        SDL_RWclose(csv);
+        SDL_Log("Texture upload results written to %s", path);
+    } else {
+        SDL_Log("Texture upload: could not write %s: %s", path, SDL_GetError());
+    }
+}
+
+void rsgl_tex_formats_step(RsglState *state)
+{
+    if (!state || !state->texfmt_running || !state->gl_ready) {
+        return;
+    }
+    if (g_texfmt.failed) {
+        state->texfmt_running = SDL_FALSE;
+        return;
+    }
+    if (SDL_GL_MakeCurrent(state->gl_window, state->gl_context) != 0) {
+        return;
+    }
+    if (!g_texfmt.created && !rsgl_texfmt_create()) {
+        SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "rsgl_tex_formats_step: texture upload sweep unavailable");
+        g_texfmt.failed = SDL_TRUE;
+        state->texfmt_running = SDL_FALSE;
+        SDL_GL_MakeCurrent(state->gl_window, NULL);
+        return;
+    }
+
+    const int cell = SDL_clamp(state->texfmt_cell, 0, rsgl_tex_formats_cells() - 1);
+    const int index = cell / RSGL_TEXFMT_REGIONS;
+    const int region = cell % RSGL_TEXFMT_REGIONS;
+    const RsglTexfmt *format = &rsgl_texfmts[index];
+    const SDL_Rect *rect = &rsgl_texfmt_regions[region];
+
+    // Storage is (re)specified outside the timed part so only the transfer is measured
+    glBindTexture(GL_TEXTURE_2D, g_texfmt.texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, (GLint)format->format, RSGL_TEXFMT_WIDTH, RSGL_TEXFMT_HEIGHT, 0,
+                 format->format, format->type, NULL);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glActiveTexture(GL_TEXTURE0);
+
+    state->texfmt_convert_ms[index][region] = rsgl_texfmt_convert(format, rect);
+
+    rsgl_texfmt_upload(format, rect);
+    rsgl_texfmt_sample(state);
+    glFinish();
+
+    double call_ms = 0.0;
+    double latency_ms = 0.0;
+    for (int i = 0; i < RSGL_TEXFMT_UPLOADS; ++i) {
+        const Uint64 start = SDL_GetPerformanceCounter();
+        rsgl_texfmt_upload(format, rect);
+        const Uint64 returned = SDL_GetPerformanceCounter();
+        rsgl_texfmt_sample(state);
+        glFinish();
+        const Uint64 done = SDL_GetPerformanceCounter();
+        call_ms += rsgl_gl_elapsed_ms(start, returned);
+        latency_ms += rsgl_gl_elapsed_ms(start, done);
+    }
+    state->texfmt_call_ms[index][region] = call_ms / RSGL_TEXFMT_UPLOADS;
+    state->texfmt_latency_ms[index][region] = latency_ms / RSGL_TEXFMT_UPLOADS;
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    SDL_GL_MakeCurrent(state->gl_window, NULL);
+
+    // This frame's time includes the sweep, so keep it out of the per-mode frame stats
+    state->postfx_drawn_config = -1;
+    state->stream_drawn_mode = -1;
+    state->texfmt_cell = cell + 1;
+    if (state->texfmt_cell >= rsgl_tex_formats_cells()) {
+        state->texfmt_running = SDL_FALSE;
+        state->texfmt_cell = 0;
+        state->texfmt_measured = SDL_TRUE;
+        rsgl_texfmt_report(state);
+    }
+}
+
+void rsgl_tex_formats_cleanup(RsglState *state)
+{
+    (void)state;
+
+    if (g_texfmt.program) {
+        glDeleteProgram(g_texfmt.program);
+    }
+    if (g_texfmt.texture) {
+        glDeleteTextures(1, &g_texfmt.texture);
+    }
+    if (g_texfmt.sample_fbo) {
+        glDeleteFramebuffers(1, &g_texfmt.sample_fbo);
+    }
+    if (g_texfmt.sample_texture) {
+        glDeleteTextures(1, &g_texfmt.sample_texture);
+    }
+    SDL_free(g_texfmt.source);
+    SDL_free(g_texfmt.converted);
+    SDL_memset(&g_texfmt, 0, sizeof(g_texfmt));
+}
@@ -0,0 +1,24 @@
+#ifndef RENDER_SUITE_GL_SCENES_TEX_FORMATS_H
+#define RENDER_SUITE_GL_SCENES_TEX_FORMATS_H
+
+#include <SDL2/SDL.h>
+
+#include "render_suite_gl/state.h"
+
+/*
+ * Uploads a full-screen RGBA8888 frame, and a quarter of it, with
+ * glTexSubImage2D in each GLES2 format/type pair, one format x region cell
+ * per frame. The CPU conversion from RGBA8888 is timed on its own so cores
+ * that already produce the format can ignore it. Results are logged and
+ * written to rsgl_tex_formats.csv when the sweep completes.
+ */
+void rsgl_tex_formats_step(RsglState *state);
+
+int rsgl_tex_formats_cells(void);
+const char *rsgl_tex_formats_name(int format);
+double rsgl_tex_formats_bytes(int format, int region);
+int rsgl_tex_formats_fastest(const RsglState *state, int region); // Lowest convert + latency, -1 if unmeasured
+
+void rsgl_tex_formats_cleanup(RsglState *state); // GL must be current
+
+#endif /* RENDER_SUITE_GL_SCENES_TEX_FORMATS_H */
@@ -44,6 +44,12 @@ void rsgl_state_init(RsglState *state)
     rsgl_state_apply_fbo_preset(state, RSGL_FBO_DEFAULT_INDEX);
     state->fbo_prev_size_index = state->fbo_size_index;
     state->fbo_dirty = SDL_FALSE;
+    state->readback_mode = RSGL_READBACK_RING2;
+    state->postfx_downsamples = 2;
+    state->postfx_kernel = 1;
+    state->postfx_scale = 1;
+    state->postfx_drawn_config = -1;
+    state->stream_drawn_mode = -1;
 }
 
 void rsgl_state_update_layout(RsglState *state, BenchOverlay *overlay)
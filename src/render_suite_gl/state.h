@@ -9,6 +9,47 @@
 #define RSGL_EFFECT_MAX 15
 #define RSGL_FBO_PRESET_COUNT 4
 #define RSGL_FBO_DEFAULT_INDEX 1
+#define RSGL_FBO_RING_MAX 3
+#define RSGL_POSTFX_DOWNSAMPLES_MAX 5
+#define RSGL_POSTFX_KERNELS 3   // 5, 9 and 13 tap blurs
+#define RSGL_POSTFX_SCALES 2    // Scene target at 1x or 2x the FBO size
+#define RSGL_POSTFX_CONFIGS (RSGL_POSTFX_DOWNSAMPLES_MAX * RSGL_POSTFX_KERNELS * RSGL_POSTFX_SCALES)
+#define RSGL_ALU_VARIANTS 10
+#define RSGL_ALU_OP_CLASSES 4  // ALU, texture fetch, transcendental, dependent read
+#define RSGL_TEXFMT_FORMATS 6
+#define RSGL_TEXFMT_REGIONS 2   // Full screen, then a centred quarter
+
+typedef enum {
+    RSGL_READBACK_IMMEDIATE = 0, // Read the FBO just drawn, waiting for the GPU to finish it
+    RSGL_READBACK_RING2,         // Draw into one of two FBOs, read the frame drawn last time
+    RSGL_READBACK_RING3,         // Same with three, reading the frame drawn two frames ago
+    RSGL_READBACK_FINISH,        // glFinish, then read: splits the stall from the copy
+    RSGL_READBACK_MODE_MAX
+} RsglReadbackMode;
+
+typedef enum {
+    RSGL_STAGE_SUBMIT = 0,       // CPU time issuing the effect (and post-processing) draws
+    RSGL_STAGE_GPU,              // Waiting on a fence, or glFinish, for those draws to complete
+    RSGL_STAGE_READBACK,         // glReadPixels
+    RSGL_STAGE_UPLOAD,           // Row copy + SDL_UnlockTexture handing the frame to SDL
+    RSGL_STAGE_MAX
+} RsglStage;
+
+typedef enum {
+    RSGL_STREAM_OFF = 0,
+    RSGL_STREAM_ORPHAN,          // glBufferData(NULL) then glBufferSubData, one VBO
+    RSGL_STREAM_SUBDATA_RING,    // glBufferSubData into the next third of one large VBO
+    RSGL_STREAM_ROUND_ROBIN,     // glBufferSubData into the next of three VBOs
+    RSGL_STREAM_CLIENT,          // Client-side vertex arrays, no VBO
+    RSGL_STREAM_MODE_MAX
+} RsglStreamMode;
+
+typedef enum {
+    RSGL_POSTFX_PARAM_DOWNSAMPLES = 0, // Halvings in the bloom chain: one pass and FBO switch each
+    RSGL_POSTFX_PARAM_SCALE,           // Scene target size: fill rate of every pass
+    RSGL_POSTFX_PARAM_KERNEL,          // Blur taps: texture fetches per blurred pixel
+    RSGL_POSTFX_PARAM_MAX
+} RsglPostfxParam;
 
 typedef struct {
     int width;
@@ -28,7 +69,7 @@ typedef struct {
 
     TTF_Font *font;
     SDL_Texture *screen_texture;
-    Uint8 *pixel_buffer;
+    Uint8 *pixel_buffer;              // Only allocated when the texture pitch rules out a direct read
     size_t pixel_capacity;
 
     int screen_width;
@@ -43,11 +84,76 @@ typedef struct {
     SDL_GLContext gl_context;
     Uint32 gl_vbo;
     Uint32 gl_ibo;
-    Uint32 gl_fbo;
-    Uint32 gl_color_texture;
+    Uint32 gl_fbo[RSGL_FBO_RING_MAX];
+    Uint32 gl_color_texture[RSGL_FBO_RING_MAX];
+    int readback_mode;
+    int ring_depth;                   // FBOs in use by the current mode
+    int ring_head;                    // Slot the next frame is drawn into
+    int ring_filled;                  // Slots holding a rendered frame since the ring was reset
+    double readback_ms[RSGL_READBACK_MODE_MAX]; // glReadPixels time only
+    Uint64 readback_runs[RSGL_READBACK_MODE_MAX];
+    double finish_ms;                 // glFinish time in RSGL_READBACK_FINISH
+    SDL_bool readback_direct;         // Last frame was read straight into the locked texture
+
+    double shader_ms[RSGL_EFFECT_MAX];      // Compile + link, or binary load, per effect; 0 until first use
+    SDL_bool shader_cached[RSGL_EFFECT_MAX];
+    double shader_saved_ms;                 // Cold build time the program binary cache avoided
+    SDL_bool shader_cache_supported;        // GL_OES_get_program_binary with at least one format
+
+    SDL_bool postfx_enabled;
+    int postfx_param;                 // RsglPostfxParam RIGHT steps
+    int postfx_downsamples;           // 1..RSGL_POSTFX_DOWNSAMPLES_MAX
+    int postfx_kernel;                // 0..RSGL_POSTFX_KERNELS - 1
+    int postfx_scale;                 // 1..RSGL_POSTFX_SCALES
+    int postfx_drawn_config;          // rsgl_postfx_config_index of the last frame, -1 before the first
+    int postfx_passes;                // Passes (and FBO binds) in the last frame, effect included
+    Uint64 postfx_pixels;             // Fragments shaded across those passes
+    Uint64 postfx_fetches;            // Blur texture fetches among them
+    double postfx_ms[RSGL_POSTFX_CONFIGS + 1];     // Frame time per configuration, [0] with post-processing off
+    Uint64 postfx_frames[RSGL_POSTFX_CONFIGS + 1];
+    Uint64 postfx_config_pixels[RSGL_POSTFX_CONFIGS + 1];
+    Uint64 postfx_config_fetches[RSGL_POSTFX_CONFIGS + 1];
+
+    SDL_bool alu_running;             // Generated-shader sweep in progress
+    int alu_cell;                     // Next variant x FBO preset cell to time
+    double alu_ms[RSGL_ALU_VARIANTS][RSGL_FBO_PRESET_COUNT]; // Per draw, bracketed by glFinish
+    double alu_ns_per_pixel[RSGL_ALU_VARIANTS];              // Slope across the presets
+    double alu_cost_ns[RSGL_ALU_OP_CLASSES + 1];             // Fitted ns/pixel: base, then per op
+    SDL_bool alu_fitted;
+
+    SDL_bool stage_timing;            // Wait for the GPU after each frame so every stage is timed alone
+    SDL_bool stage_fence;             // Waits use EGL_KHR_fence_sync rather than glFinish
+    double stage_last_ms[RSGL_STAGE_MAX];
+    double stage_ms[RSGL_EFFECT_MAX][RSGL_FBO_PRESET_COUNT][RSGL_STAGE_MAX];
+    Uint64 stage_runs[RSGL_EFFECT_MAX][RSGL_FBO_PRESET_COUNT];
+    SDL_bool headless;                // Offscreen video driver: frames are read back, never shown
+
+    int stream_mode;                  // Sprite layer over the effect, RSGL_STREAM_OFF for none
+    int stream_drawn_mode;            // Mode the last frame was drawn with, -1 before the first
+    int stream_vertices;              // Vertices streamed last frame
+    double stream_submit_last_ms;     // Vertex generation excluded: upload + draw call only
+    double stream_submit_ms[RSGL_STREAM_MODE_MAX];
+    double stream_frame_ms[RSGL_STREAM_MODE_MAX];
+    Uint64 stream_frames[RSGL_STREAM_MODE_MAX];
+    Uint64 stream_total_vertices[RSGL_STREAM_MODE_MAX];
+
+    SDL_bool texfmt_running;          // Texture format sweep in progress
+    int texfmt_cell;                  // Next format x region cell to time
+    SDL_bool texfmt_measured;
+    double texfmt_convert_ms[RSGL_TEXFMT_FORMATS][RSGL_TEXFMT_REGIONS]; // RGBA8888 source to the format
+    double texfmt_call_ms[RSGL_TEXFMT_FORMATS][RSGL_TEXFMT_REGIONS];    // glTexSubImage2D returning
+    double texfmt_latency_ms[RSGL_TEXFMT_FORMATS][RSGL_TEXFMT_REGIONS]; // Until a draw sampling it finished
+    SDL_bool overlay_texfmt;          // Last overlay row shows the texture sweep rather than the ALU one
     SDL_bool gl_ready;
     SDL_bool gl_library_loaded;
-    SDL_bool gl_external;
+    SDL_bool gl_external;             // Window, context and quad/FBO objects came from the loading screen
+    double gl_init_ms;                // GL setup done by rsgl_effects_init itself
+    double gl_context_reused_ms;      // Loading screen library, window and context setup taken over
+    double gl_targets_ms;             // rsgl_create_targets alone; compare runs with and without a handover
+    int gl_objects_reused;            // Handed-over objects rsgl_create_targets did not create
+    SDL_bool gl_slot0_kept;           // Handed-over slot 0 was already the right size, so not re-specified
+    int gl_ring_width[RSGL_FBO_RING_MAX];  // Size each ring texture was last specified at, 0 if never
+    int gl_ring_height[RSGL_FBO_RING_MAX];
 } RsglState;
 
 void rsgl_state_init(RsglState *state);
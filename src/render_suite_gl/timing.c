@@ -0,0 +1,125 @@
+#include "render_suite_gl/timing.h"
+
+#include <SDL2/SDL_log.h>
+#include <SDL2/SDL_opengles2.h>
+#include <SDL2/SDL_egl.h>
+
+#include "render_suite_gl/gl_util.h"
+#include "render_suite_gl/scenes/effects.h"
+
+typedef EGLDisplay (EGLAPIENTRYP RsglEglGetCurrentDisplayProc)(void);
+typedef const char *(EGLAPIENTRYP RsglEglQueryStringProc)(EGLDisplay dpy, EGLint name);
+
+static const char *rsgl_stage_names[RSGL_STAGE_MAX] = {
+    "submit",
+    "gpu",
+    "read",
+    "upload"
+};
+
+static EGLDisplay rsgl_egl_display = EGL_NO_DISPLAY;
+static PFNEGLCREATESYNCKHRPROC rsgl_egl_create_sync = NULL;
+static PFNEGLCLIENTWAITSYNCKHRPROC rsgl_egl_client_wait_sync = NULL;
+static PFNEGLDESTROYSYNCKHRPROC rsgl_egl_destroy_sync = NULL;
+
+void rsgl_timing_init(RsglState *state)
+{
+    if (!state) {
+        return;
+    }
+
+    rsgl_egl_display = EGL_NO_DISPLAY;
+    rsgl_egl_create_sync = NULL;
+    rsgl_egl_client_wait_sync = NULL;
+    rsgl_egl_destroy_sync = NULL;
+    state->stage_fence = SDL_FALSE;
+
+    // Only resolvable when SDL created the context through EGL
+    RsglEglGetCurrentDisplayProc get_display =
+        (RsglEglGetCurrentDisplayProc)SDL_GL_GetProcAddress("eglGetCurrentDisplay");
+    RsglEglQueryStringProc query_string =
+        (RsglEglQueryStringProc)SDL_GL_GetProcAddress("eglQueryString");
+    const EGLDisplay display = get_display ? get_display() : EGL_NO_DISPLAY;
+    const char *extensions = (display != EGL_NO_DISPLAY && query_string) ?
+        query_string(display, EGL_EXTENSIONS) : NULL;
+    if (extensions && SDL_strstr(extensions, "EGL_KHR_fence_sync")) {
+        rsgl_egl_create_sync = (PFNEGLCREATESYNCKHRPROC)SDL_GL_GetProcAddress("eglCreateSyncKHR");
+        rsgl_egl_client_wait_sync =
+            (PFNEGLCLIENTWAITSYNCKHRPROC)SDL_GL_GetProcAddress("eglClientWaitSyncKHR");
+        rsgl_egl_destroy_sync = (PFNEGLDESTROYSYNCKHRPROC)SDL_GL_GetProcAddress("eglDestroySyncKHR");
+    }
+    if (rsgl_egl_create_sync && rsgl_egl_client_wait_sync && rsgl_egl_destroy_sync) {
+        rsgl_egl_display = display;
+        state->stage_fence = SDL_TRUE;
+    }
+    SDL_Log("GL stage timing: GPU waits use %s", state->stage_fence ? "EGL fences" : "glFinish");
+}
+
+double rsgl_timing_wait_gpu(const RsglState *state)
+{
+    const Uint64 start = SDL_GetPerformanceCounter();
+    EGLSyncKHR sync = EGL_NO_SYNC_KHR;
+    if (state && state->stage_fence) {
+        sync = rsgl_egl_create_sync(rsgl_egl_display, EGL_SYNC_FENCE_KHR, NULL);
+    }
+    if (sync != EGL_NO_SYNC_KHR) {
+        rsgl_egl_client_wait_sync(rsgl_egl_display, sync, EGL_SYNC_FLUSH_COMMANDS_BIT_KHR, EGL_FOREVER_KHR);
+        rsgl_egl_destroy_sync(rsgl_egl_display, sync);
+    } else {
+        glFinish();
+    }
+    return rsgl_gl_elapsed_ms(start, SDL_GetPerformanceCounter());
+}
+
+void rsgl_timing_record(RsglState *state, int effect, const double stage_ms[RSGL_STAGE_MAX])
+{
+    if (!state || effect < 0 || effect >= RSGL_EFFECT_MAX) {
+        return;
+    }
+    const int preset = SDL_clamp(state->fbo_size_index, 0, RSGL_FBO_PRESET_COUNT - 1);
+    for (int stage = 0; stage < RSGL_STAGE_MAX; ++stage) {
+        state->stage_last_ms[stage] = stage_ms[stage];
+        state->stage_ms[effect][preset][stage] += stage_ms[stage];
+    }
+    state->stage_runs[effect][preset]++;
+}
+
+double rsgl_timing_avg_ms(const RsglState *state, int effect, int preset, int stage)
+{
+    if (!state || effect < 0 || effect >= RSGL_EFFECT_MAX ||
+        preset < 0 || preset >= RSGL_FBO_PRESET_COUNT ||
+        stage < 0 || stage >= RSGL_STAGE_MAX ||
+        state->stage_runs[effect][preset] == 0) {
+        return 0.0;
+    }
+    return state->stage_ms[effect][preset][stage] / (double)state->stage_runs[effect][preset];
+}
+
+const char *rsgl_timing_stage_name(int stage)
+{
+    return rsgl_stage_names[SDL_clamp(stage, 0, RSGL_STAGE_MAX - 1)];
+}
+
+void rsgl_timing_report(const RsglState *state)
+{
+    if (!state) {
+        return;
+    }
+
+    for (int effect = 0; effect < RSGL_EFFECT_MAX; ++effect) {
+        for (int preset = 0; preset < RSGL_FBO_PRESET_COUNT; ++preset) {
+            if (state->stage_runs[effect][preset] == 0) {
+                continue;
+            }
+            SDL_Log("Stages %-16s %-7s: submit %.3f | gpu %.3f | read %.3f | upload %.3f ms (%llu, %s)",
+                    rsgl_effect_name(effect),
+                    rsgl_fbo_presets[preset].label,
+                    rsgl_timing_avg_ms(state, effect, preset, RSGL_STAGE_SUBMIT),
+                    rsgl_timing_avg_ms(state, effect, preset, RSGL_STAGE_GPU),
+                    rsgl_timing_avg_ms(state, effect, preset, RSGL_STAGE_READBACK),
+                    rsgl_timing_avg_ms(state, effect, preset, RSGL_STAGE_UPLOAD),
+                    (unsigned long long)state->stage_runs[effect][preset],
+                    state->stage_fence ? "fence" : "finish");
+        }
+    }
+}
@@ -0,0 +1,20 @@
+#ifndef RENDER_SUITE_GL_TIMING_H
+#define RENDER_SUITE_GL_TIMING_H
+
+#include <SDL2/SDL.h>
+
+#include "render_suite_gl/state.h"
+
+/*
+ * Per-stage frame timing. GPU completion is waited on with an
+ * EGL_KHR_fence_sync fence when the context is EGL-backed and exposes one,
+ * and with glFinish otherwise, so software and GLX contexts still work.
+ */
+void rsgl_timing_init(RsglState *state);          // GL must be current
+double rsgl_timing_wait_gpu(const RsglState *state); // GL must be current; returns ms waited
+void rsgl_timing_record(RsglState *state, int effect, const double stage_ms[RSGL_STAGE_MAX]);
+double rsgl_timing_avg_ms(const RsglState *state, int effect, int preset, int stage);
+const char *rsgl_timing_stage_name(int stage);
+void rsgl_timing_report(const RsglState *state);
+
+#endif /* RENDER_SUITE_GL_TIMING_H */